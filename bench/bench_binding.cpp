@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Cost of bound properties per frame.
+//
+//   smlui_bench_binding [frames] [fields]
+//
+// Builds a panel with `fields` (default 5000) labels, each bound to a
+// derived value "field.N.text" computed from a plain value "field.N".
+// For three cases (nothing changed, one value changed, every value
+// changed) it prints the median time of UiBindings::update(), the number
+// of derived values computed per frame and whether needsRedraw() asked
+// for the frame at all. Unchanged frames should compute nothing and not
+// need a redraw.
+
+#include "sml_ui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+void FormatField(const smlui::UiBindings& bindings, const smlui::UiBindings::Key* inputs, size_t,
+                 std::string* out, void*) {
+    out->append("value: ");
+    out->append(bindings.value(inputs[0]));
+}
+
+std::string MakeLayout(int fields) {
+    std::string text = "Window {\n    title: \"Bindings\"\n    DockLayout {\n        Right { label: \"Fields\" width: 400\n            Column {\n";
+    for (int i = 0; i < fields; ++i)
+        text += "                Label { text: \"bind(field." + std::to_string(i) + ".text)\" }\n";
+    text += "            }\n        }\n    }\n}\n";
+    return text;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 200;
+    int fields = argc > 2 ? std::atoi(argv[2]) : 5000;
+    const int warmup_frames = 5;
+
+    smlui::UiDocument document;
+    std::string error;
+    if (!document.parseFromString(MakeLayout(fields), &error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    smlui::UiBindings bindings;
+    std::vector<smlui::UiBindings::Key> inputs((size_t)fields);
+    for (int i = 0; i < fields; ++i) {
+        std::string path = "field." + std::to_string(i);
+        inputs[(size_t)i] = bindings.key(path);
+        bindings.set(inputs[(size_t)i], i);
+        bindings.define(path + ".text", std::vector<std::string>(1, path), FormatField, nullptr);
+    }
+    document.setBindings(&bindings);
+
+    ImGuiContext* context = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = nullptr;
+    io.Fonts->Build();
+
+    const char* const kCases[] = {"unchanged", "one_changed", "all_changed"};
+    std::printf("[\n");
+    for (int c = 0; c < 3; ++c) {
+        std::vector<double> update_us;
+        size_t evaluated = 0;
+        int redraws = 0;
+        for (int f = 0; f < warmup_frames + frames; ++f) {
+            if (c == 1)
+                bindings.set(inputs[(size_t)(f % fields)], fields + f);
+            else if (c == 2)
+                for (int i = 0; i < fields; ++i)
+                    bindings.set(inputs[(size_t)i], fields * (f + 2) + i);
+            bool redraw = document.needsRedraw();
+            Clock::time_point start = Clock::now();
+            size_t computed = bindings.update();
+            Clock::time_point end = Clock::now();
+            // Draw every frame so the settle frames after setBindings() pass.
+            ImGui::NewFrame();
+            document.render(ImGui::GetMainViewport(), nullptr, nullptr);
+            ImGui::Render();
+            if (f < warmup_frames)
+                continue;
+            update_us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+            evaluated += computed;
+            redraws += redraw ? 1 : 0;
+        }
+        std::printf("%s  {\"case\": \"%s\", \"fields\": %d, \"frames\": %d, \"update_us\": %.2f, "
+                    "\"evaluated_per_frame\": %.1f, \"redraw_frames\": %d}",
+                    c == 0 ? "" : ",\n", kCases[c], fields, frames, Median(update_us),
+                    frames > 0 ? (double)evaluated / frames : 0.0, redraws);
+    }
+    std::printf("\n]\n");
+    ImGui::DestroyContext(context);
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Compares element/property name resolution in UiSmlHandler: the former
+// chain of std::string comparisons against the interned symbol lookup.
+// Replays the name stream of a typical editor layout many times.
+
+#include "sml_ui_symbols.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace smlui;
+
+namespace {
+
+int LegacyElement(const std::string& name) {
+    if (name == "MainMenu") return 1;
+    if (name == "Menu") return 2;
+    if (name == "MenuItem") return 3;
+    if (name == "Separator") return 4;
+    if (name == "DockLayout") return 5;
+    if (name == "MenuBar") return 6;
+    if (name == "ToolBar") return 7;
+    if (name == "StatusBar") return 8;
+    if (name == "PropertyPanel") return 9;
+    if (name == "Viewport3D") return 10;
+    if (name == "Overlay") return 11;
+    if (name == "Window" || name == "state" || name == "Label" || name == "Top" ||
+        name == "Bottom" || name == "Left" || name == "Right" || name == "Center" ||
+        name == "ToolButton")
+        return 12;
+    return 0;
+}
+
+int LegacyProperty(const std::string& element, const std::string& name) {
+    if (element == "Window") {
+        if (name == "title") return 1;
+        if (name == "position") return 2;
+        if (name == "size") return 3;
+        return 0;
+    }
+    if (element == "state") {
+        if (name == "persist") return 4;
+        if (name == "theme") return 5;
+        if (name == "pos") return 6;
+        if (name == "size") return 7;
+        if (name == "maximized") return 8;
+        if (name == "lastFilePath") return 9;
+        if (name == "docking") return 10;
+        return 0;
+    }
+    if (element == "Label") {
+        if (name == "position") return 11;
+        if (name == "text") return 12;
+        if (name == "fontSize") return 13;
+        return 0;
+    }
+    if (element == "Menu")
+        return name == "label" ? 14 : 0;
+    if (element == "MenuItem") {
+        if (name == "label") return 15;
+        if (name == "clicked") return 16;
+        if (name == "action") return 17;
+        if (name == "useOnMac") return 18;
+        return 0;
+    }
+    if (name == "height")
+        return (element == "Top" || element == "ToolBar" || element == "Bottom" || element == "StatusBar") ? 19 : 0;
+    if ((element == "Left" || element == "Right") && name == "width")
+        return 20;
+    if (name == "label")
+        return (element == "Left" || element == "Right" || element == "Center" || element == "Top" || element == "Bottom") ? 21 : 0;
+    if (element == "ToolButton" && name == "icon")
+        return 22;
+    return 0;
+}
+
+struct Event {
+    std::string element;
+    std::string property; // empty for startElement
+};
+
+std::vector<Event> BuildEventStream() {
+    std::vector<Event> events;
+    auto element = [&](const char* e) { events.push_back(Event{e, std::string()}); };
+    auto property = [&](const char* e, const char* p) { events.push_back(Event{e, p}); };
+    element("Window");
+    property("Window", "title");
+    property("Window", "size");
+    element("state");
+    property("state", "persist");
+    property("state", "pos");
+    property("state", "size");
+    property("state", "docking");
+    element("MainMenu");
+    for (int m = 0; m < 4; ++m) {
+        element("Menu");
+        property("Menu", "label");
+        for (int i = 0; i < 6; ++i) {
+            element("MenuItem");
+            property("MenuItem", "label");
+            property("MenuItem", "action");
+            property("MenuItem", "useOnMac");
+        }
+        element("Separator");
+    }
+    element("DockLayout");
+    element("Top");
+    property("Top", "height");
+    element("ToolBar");
+    for (int i = 0; i < 8; ++i) {
+        element("ToolButton");
+        property("ToolButton", "icon");
+    }
+    element("Left");
+    property("Left", "label");
+    property("Left", "width");
+    for (int i = 0; i < 8; ++i) {
+        element("ToolButton");
+        property("ToolButton", "icon");
+    }
+    element("Right");
+    property("Right", "label");
+    property("Right", "width");
+    element("PropertyPanel");
+    element("Center");
+    property("Center", "label");
+    element("Viewport3D");
+    element("Overlay");
+    element("Bottom");
+    property("Bottom", "height");
+    element("StatusBar");
+    return events;
+}
+
+template <typename Fn>
+double TimeMs(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 20000;
+    std::vector<Event> events = BuildEventStream();
+    volatile unsigned sink = 0;
+
+    double legacy_ms = TimeMs([&]() {
+        unsigned acc = 0;
+        for (int it = 0; it < iterations; ++it) {
+            for (size_t i = 0; i < events.size(); ++i) {
+                const Event& e = events[i];
+                acc += e.property.empty() ? LegacyElement(e.element) : LegacyProperty(e.element, e.property);
+            }
+        }
+        sink = sink + acc;
+    });
+
+    // Mirrors UiSmlHandler: the element is interned once on startElement,
+    // properties dispatch on the cached ElementId.
+    double interned_ms = TimeMs([&]() {
+        unsigned acc = 0;
+        for (int it = 0; it < iterations; ++it) {
+            ElementId current = ElementId::Unknown;
+            for (size_t i = 0; i < events.size(); ++i) {
+                const Event& e = events[i];
+                if (e.property.empty()) {
+                    current = LookupElement(e.element);
+                    acc += (unsigned)current;
+                } else {
+                    acc += (unsigned)current * 32u + (unsigned)LookupProperty(e.property);
+                }
+            }
+        }
+        sink = sink + acc;
+    });
+
+    double lookups = (double)events.size() * (double)iterations;
+    std::printf("events per layout : %zu\n", events.size());
+    std::printf("iterations        : %d\n", iterations);
+    std::printf("string compare    : %8.2f ms  %6.1f ns/event\n", legacy_ms, legacy_ms * 1e6 / lookups);
+    std::printf("interned lookup   : %8.2f ms  %6.1f ns/event\n", interned_ms, interned_ms * 1e6 / lookups);
+    std::printf("speedup           : %.2fx\n", interned_ms > 0.0 ? legacy_ms / interned_ms : 0.0);
+    return 0;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Frame-time spikes caused by dynamic glyph baking.
+//
+//   smlui_bench_glyph_upload [frames] [font.ttf|.ttc]
+//
+// Types random CJK characters (U+4E00..U+9FFF) into a wrapped text
+// window, a few per frame, on a headless Vulkan device. Almost every
+// frame bakes new glyphs, so the font atlas texture is updated through
+// ImGui_ImplVulkan_UpdateTexture() all the time. The benchmark prints the
+// median, p99 and maximum frame time and time spent in
+// ImGui_ImplVulkan_RenderDrawData(), split into frames with and without
+// atlas updates, plus the number of spikes (frames slower than 4x the
+// median) and the staging bytes and copy regions per upload frame from
+// ImGui_ImplVulkan_GetUploadStats(). A CJK font is required; without one
+// no glyphs get baked.
+
+#include "bench_vulkan.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* kDefaultFonts[] = {
+    "/usr/share/fonts/opentype/noto/NotoSansCJK-Regular.ttc",
+    "/usr/share/fonts/noto-cjk/NotoSansCJK-Regular.ttc",
+    "/usr/share/fonts/google-noto-cjk/NotoSansCJK-Regular.ttc",
+    "/usr/share/fonts/truetype/wqy/wqy-microhei.ttc",
+    "/System/Library/Fonts/PingFang.ttc",
+    "C:\\Windows\\Fonts\\msyh.ttc",
+};
+
+typedef std::chrono::steady_clock Clock;
+
+double Micros(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+double Percentile(std::vector<double> values, double p) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t i = (size_t)(p * (double)(values.size() - 1));
+    return values[i];
+}
+
+void AppendUtf8(std::string& out, unsigned int c) {
+    out += (char)(0xE0 | (c >> 12));
+    out += (char)(0x80 | ((c >> 6) & 0x3F));
+    out += (char)(0x80 | (c & 0x3F));
+}
+
+bool AtlasNeedsUpload(const ImDrawData* draw_data) {
+    if (draw_data->Textures == nullptr)
+        return false;
+    for (ImTextureData* tex : *draw_data->Textures)
+        if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+            return true;
+    return false;
+}
+
+void PrintStats(const char* name, const std::vector<double>& values, bool last) {
+    std::printf("    \"%s\": {\"count\": %d, \"p50_us\": %.1f, \"p99_us\": %.1f, \"max_us\": %.1f}%s\n",
+                name, (int)values.size(), Percentile(values, 0.5), Percentile(values, 0.99),
+                values.empty() ? 0.0 : *std::max_element(values.begin(), values.end()), last ? "" : ",");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 3000;
+    const char* font_path = argc > 2 ? argv[2] : nullptr;
+    for (size_t i = 0; font_path == nullptr && i < sizeof(kDefaultFonts) / sizeof(kDefaultFonts[0]); ++i) {
+        if (FILE* f = std::fopen(kDefaultFonts[i], "rb")) {
+            std::fclose(f);
+            font_path = kDefaultFonts[i];
+        }
+    }
+    if (font_path == nullptr) {
+        std::fprintf(stderr, "no CJK font found, pass one as second argument\n");
+        return 1;
+    }
+
+    bench::VulkanBench vk;
+    if (!vk.init(1280, 720))
+        return 1;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1280.0f, 720.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = nullptr;
+    if (io.Fonts->AddFontFromFileTTF(font_path, 20.0f) == nullptr) {
+        std::fprintf(stderr, "cannot load %s\n", font_path);
+        return 1;
+    }
+    ImGui_ImplVulkan_InitInfo init_info = {};
+    vk.fillInitInfo(&init_info);
+    ImGui_ImplVulkan_Init(&init_info);
+
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<unsigned int> codepoint(0x4E00, 0x9FFF);
+    std::uniform_int_distribution<int> typed_per_frame(1, 4);
+    std::string text;
+    const int warmup_frames = 10;
+    const size_t max_text_bytes = 3 * 1500;
+
+    std::vector<double> frame_upload_us, frame_plain_us, rdd_upload_us, rdd_plain_us;
+    std::vector<double> upload_bytes, upload_regions;
+    Clock::time_point previous = Clock::now();
+    for (int f = 0; f < warmup_frames + frames; ++f) {
+        int typed = typed_per_frame(rng);
+        for (int i = 0; i < typed; ++i)
+            AppendUtf8(text, codepoint(rng));
+        if (text.size() > max_text_bytes)
+            text.erase(0, text.size() - max_text_bytes);
+
+        ImGui_ImplVulkan_NewFrame();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("typing", nullptr, ImGuiWindowFlags_NoDecoration);
+        ImGui::TextWrapped("%s", text.c_str());
+        ImGui::End();
+        ImGui::Render();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        bool uploads = AtlasNeedsUpload(draw_data);
+
+        VkCommandBuffer command_buffer = vk.beginFrame();
+        Clock::time_point t0 = Clock::now();
+        ImGui_ImplVulkan_RenderDrawData(draw_data, command_buffer);
+        Clock::time_point t1 = Clock::now();
+        vk.endFrame();
+
+        Clock::time_point now = Clock::now();
+        double frame_us = Micros(previous, now);
+        previous = now;
+        if (f < warmup_frames)
+            continue;
+        (uploads ? frame_upload_us : frame_plain_us).push_back(frame_us);
+        (uploads ? rdd_upload_us : rdd_plain_us).push_back(Micros(t0, t1));
+        if (uploads) {
+            const ImGui_ImplVulkan_UploadStats* stats = ImGui_ImplVulkan_GetUploadStats();
+            upload_bytes.push_back((double)stats->FrameBytes);
+            upload_regions.push_back((double)stats->FrameRegions);
+        }
+    }
+    vk.waitIdle();
+
+    std::vector<double> all_frames = frame_upload_us;
+    all_frames.insert(all_frames.end(), frame_plain_us.begin(), frame_plain_us.end());
+    double median = Percentile(all_frames, 0.5);
+    int spikes = 0;
+    for (size_t i = 0; i < all_frames.size(); ++i)
+        if (all_frames[i] > 4.0 * median)
+            ++spikes;
+
+    const ImGui_ImplVulkan_UploadStats* stats = ImGui_ImplVulkan_GetUploadStats();
+    std::printf("{\n    \"frames\": %d, \"upload_frames\": %d, \"spikes\": %d,\n", frames,
+                (int)frame_upload_us.size(), spikes);
+    std::printf("    \"upload_bytes_p50\": %.0f, \"upload_regions_p50\": %.0f, \"union_fallbacks\": %d, \"slot_waits\": %d,\n",
+                Percentile(upload_bytes, 0.5), Percentile(upload_regions, 0.5), stats->TotalUnionFallbacks,
+                stats->TotalSlotWaits);
+    PrintStats("frame_upload", frame_upload_us, false);
+    PrintStats("frame_plain", frame_plain_us, false);
+    PrintStats("render_draw_data_upload", rdd_upload_us, false);
+    PrintStats("render_draw_data_plain", rdd_plain_us, true);
+    std::printf("}\n");
+
+    ImGui_ImplVulkan_Shutdown();
+    ImGui::DestroyContext();
+    vk.shutdown();
+    return vk.validationErrors() > 0 ? 1 : 0;
+}
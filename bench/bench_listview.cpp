@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Frame cost of a virtualized ListView against its row count.
+//
+//   smlui_bench_listview [frames] [max_rows]
+//
+// Renders a ListView headless (same setup as smlui_bench_render) with
+// 1000 up to max_rows (default 10000000) rows, scrolling a little every
+// frame. Prints one JSON object per row count with the median frame time
+// and the number of rows actually drawn per frame; both should stay flat
+// as the row count grows.
+
+#include "sml_ui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const kLayout = R"(Window {
+    title: "List"
+    DockLayout {
+        Center { label: "Assets" ListView { source: "assets" } }
+    }
+})";
+
+struct Rows {
+    size_t count = 0;
+    size_t drawn = 0;
+};
+
+size_t RowCount(void* user_data) {
+    return static_cast<Rows*>(user_data)->count;
+}
+
+void DrawRow(size_t row, void* user_data) {
+    ++static_cast<Rows*>(user_data)->drawn;
+    char text[32];
+    std::snprintf(text, sizeof(text), "asset_%zu", row);
+    ImGui::TextUnformatted(text);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 500;
+    size_t max_rows = argc > 2 ? (size_t)std::strtoull(argv[2], nullptr, 10) : 10000000;
+    const int warmup_frames = 10;
+
+    smlui::UiDocument document;
+    std::string error;
+    if (!document.parseFromString(kLayout, &error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    Rows rows;
+    smlui::UiListSource source;
+    source.count = RowCount;
+    source.draw_row = DrawRow;
+    source.user_data = &rows;
+    document.setListSource("assets", source);
+
+    std::printf("[\n");
+    for (size_t count = 1000; count <= max_rows; count *= 10) {
+        rows.count = count;
+        ImGuiContext* context = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.IniFilename = nullptr;
+        io.Fonts->Build();
+
+        std::vector<double> frame_us;
+        size_t drawn = 0;
+        for (int f = 0; f < warmup_frames + frames; ++f) {
+            // Hover the list and scroll so the visible window keeps moving.
+            io.AddMousePosEvent(960.0f, 540.0f);
+            io.AddMouseWheelEvent(0.0f, -5.0f);
+            size_t drawn_before = rows.drawn;
+            Clock::time_point start = Clock::now();
+            ImGui::NewFrame();
+            document.render(ImGui::GetMainViewport(), nullptr, nullptr);
+            ImGui::Render();
+            Clock::time_point end = Clock::now();
+            if (f < warmup_frames)
+                continue;
+            frame_us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+            drawn += rows.drawn - drawn_before;
+        }
+        std::printf("%s  {\"rows\": %zu, \"frames\": %d, \"frame_us\": %.2f, \"rows_drawn_per_frame\": %.1f}",
+                    count == 1000 ? "" : ",\n", count, frames, Median(frame_us),
+                    frames > 0 ? (double)drawn / frames : 0.0);
+        ImGui::DestroyContext(context);
+    }
+    std::printf("\n]\n");
+    return 0;
+}
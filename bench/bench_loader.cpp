@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Scaling of UiDocumentLoader across thread counts.
+//
+//   smlui_bench_loader [files] [tools_per_file]
+//
+// Writes `files` (default 400) panel layouts to a temporary directory and
+// loads the whole set with 1, 2, 4 ... hardware_concurrency threads.
+// Prints one JSON object per thread count with wall time and speedup.
+
+#include "sml_ui_loader.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::string PanelLayout(size_t index, size_t tools) {
+    static const char* const kIcons[] = {"play", "select", "move", "paint"};
+    std::string text = "Window {\n    title: \"Panel " + std::to_string(index) + "\"\n";
+    text += "    MainMenu {\n        Menu { label: \"File\"\n";
+    text += "            MenuItem { label: \"Open\" action: open }\n";
+    text += "            MenuItem { label: \"Save\" action: save }\n        }\n    }\n";
+    text += "    DockLayout {\n        Top { height: 40 ToolBar {\n";
+    for (size_t i = 0; i < tools; ++i)
+        text += std::string("            ToolButton { icon: ") + kIcons[i % 4] + " }\n";
+    text += "        } }\n        Left { label: \"Tools\" width: 56\n";
+    for (size_t i = 0; i < tools; ++i)
+        text += std::string("            ToolButton { icon: ") + kIcons[(i + 1) % 4] + " }\n";
+    text += "        }\n        Right { label: \"Properties\" width: 360 PropertyPanel { } }\n";
+    text += "        Center { label: \"Viewport\" Viewport3D { } }\n    }\n}\n";
+    return text;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t file_count = argc > 1 ? (size_t)std::strtoul(argv[1], nullptr, 10) : 400;
+    size_t tools = argc > 2 ? (size_t)std::strtoul(argv[2], nullptr, 10) : 200;
+
+#if defined(_WIN32)
+    std::string directory = ".";
+#else
+    char directory_template[] = "/tmp/smlui_bench_loader.XXXXXX";
+    if (!mkdtemp(directory_template)) {
+        std::fprintf(stderr, "cannot create temporary directory\n");
+        return 1;
+    }
+    std::string directory = directory_template;
+#endif
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < file_count; ++i) {
+        std::string path = directory + "/panel_" + std::to_string(i) + ".sml";
+        std::ofstream out(path.c_str(), std::ios::binary);
+        out << PanelLayout(i, tools);
+        paths.push_back(path);
+    }
+
+    unsigned max_threads = std::thread::hardware_concurrency();
+    if (max_threads == 0)
+        max_threads = 1;
+    double baseline_ms = 0.0;
+    std::printf("[\n");
+    for (unsigned threads = 1;; threads = threads * 2 > max_threads && threads < max_threads ? max_threads : threads * 2) {
+        smlui::UiDocumentLoader loader(threads);
+        size_t failed = 0;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<smlui::UiLoadResult> results = loader.loadAll(paths, &failed);
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (threads == 1)
+            baseline_ms = ms;
+        std::printf("%s  {\"threads\": %u, \"files\": %zu, \"failed\": %zu, \"wall_ms\": %.2f, "
+                    "\"files_per_s\": %.0f, \"speedup\": %.2f}",
+                    threads == 1 ? "" : ",\n", threads, results.size(), failed, ms,
+                    (double)results.size() * 1000.0 / ms, ms > 0.0 ? baseline_ms / ms : 0.0);
+        if (threads >= max_threads)
+            break;
+    }
+    std::printf("\n]\n");
+
+    for (size_t i = 0; i < paths.size(); ++i)
+        std::remove(paths[i].c_str());
+#if !defined(_WIN32)
+    rmdir(directory.c_str());
+#endif
+    return 0;
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Parse throughput of UiDocument::parseFromString over synthetic layouts.
+//
+//   smlui_bench_parse [max_elements] [min_seconds]
+//
+// Generates documents from 10 up to max_elements (default 100000)
+// elements and prints one JSON object per size: input bytes, element
+// count, median parse time, MB/s, elements/s, node tree size and peak RSS.
+
+#include "sml_ui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+struct Corpus {
+    std::string text;
+    size_t elements = 0;
+};
+
+class CorpusWriter {
+public:
+    explicit CorpusWriter(Corpus* corpus) : corpus_(corpus) {}
+
+    void open(const char* name) {
+        indent();
+        corpus_->text += name;
+        corpus_->text += " {\n";
+        ++depth_;
+        ++corpus_->elements;
+    }
+    void close() {
+        --depth_;
+        indent();
+        corpus_->text += "}\n";
+    }
+    void property(const char* name, const std::string& value) {
+        indent();
+        corpus_->text += name;
+        corpus_->text += ": ";
+        corpus_->text += value;
+        corpus_->text += "\n";
+    }
+    void text(const char* name, const std::string& value) {
+        property(name, "\"" + value + "\"");
+    }
+    size_t elements() const { return corpus_->elements; }
+
+private:
+    void indent() { corpus_->text.append((size_t)depth_ * 4, ' '); }
+
+    Corpus* corpus_;
+    int depth_ = 0;
+};
+
+std::string LongText(size_t index, size_t length) {
+    std::string text = "Entry " + std::to_string(index) + " ";
+    while (text.size() < length)
+        text += "lorem ipsum dolor sit amet ";
+    text.resize(length);
+    return text;
+}
+
+// Roughly a third of the budget each goes to the main menu, the toolbar
+// and a deeply nested left dock column; long strings appear every 16th
+// label.
+Corpus GenerateCorpus(size_t target_elements) {
+    static const char* const kIcons[] = {"play", "select", "move", "paint"};
+    static const char* const kActions[] = {"open", "save", "saveAs", "closeQuery"};
+    const int kNestingDepth = 24;
+
+    Corpus corpus;
+    corpus.text.reserve(target_elements * 48);
+    CorpusWriter w(&corpus);
+    w.open("Window");
+    w.text("title", "Synthetic " + std::to_string(target_elements));
+    w.property("size", "1280,720");
+    w.open("state");
+    w.property("persist", "project");
+    w.property("docking", "true");
+    w.close();
+
+    size_t budget = target_elements > 16 ? target_elements - 16 : 0;
+    size_t menu_budget = budget / 3;
+    size_t tool_budget = budget / 3;
+    size_t left_budget = budget - menu_budget - tool_budget;
+
+    w.open("MainMenu");
+    for (size_t m = 0; w.elements() < 4 + menu_budget; ++m) {
+        w.open("Menu");
+        w.text("label", m % 16 == 0 ? LongText(m, 200) : "Menu " + std::to_string(m));
+        for (size_t i = 0; i < 12 && w.elements() < 4 + menu_budget; ++i) {
+            if (i == 6) {
+                w.open("Separator");
+                w.close();
+                continue;
+            }
+            w.open("MenuItem");
+            w.text("label", i % 16 == 0 ? LongText(i, 120) : "Item " + std::to_string(i));
+            w.property("action", kActions[i % 4]);
+            w.property("useOnMac", i % 2 ? "true" : "false");
+            w.close();
+        }
+        w.close();
+    }
+    w.close();
+
+    w.open("DockLayout");
+    w.open("Top");
+    w.property("height", "40");
+    w.open("ToolBar");
+    for (size_t i = 0; i < tool_budget; ++i) {
+        w.open("ToolButton");
+        w.property("icon", kIcons[i % 4]);
+        w.close();
+    }
+    w.close();
+    w.close();
+
+    w.open("Left");
+    w.text("label", "Tools");
+    w.property("width", "56");
+    int depth = 0;
+    for (size_t i = 0; i < left_budget; ++i) {
+        if (i % 64 == 0 && depth < kNestingDepth) {
+            w.open("Left");
+            ++depth;
+            continue;
+        }
+        w.open("ToolButton");
+        w.property("icon", kIcons[i % 4]);
+        w.close();
+    }
+    for (; depth > 0; --depth)
+        w.close();
+    w.close();
+
+    w.open("Right");
+    w.text("label", LongText(0, 512));
+    w.property("width", "360");
+    w.open("PropertyPanel");
+    w.close();
+    w.close();
+    w.open("Center");
+    w.text("label", "Viewport");
+    w.open("Viewport3D");
+    w.close();
+    w.close();
+    w.open("Bottom");
+    w.property("height", "24");
+    w.open("StatusBar");
+    w.close();
+    w.close();
+    w.close();
+    w.close();
+    return corpus;
+}
+
+long PeakRssKb() {
+#if defined(_WIN32)
+    return -1;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+#if defined(__APPLE__)
+    return (long)(usage.ru_maxrss / 1024);
+#else
+    return (long)usage.ru_maxrss;
+#endif
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t max_elements = argc > 1 ? (size_t)std::strtoul(argv[1], nullptr, 10) : 100000;
+    double min_seconds = argc > 2 ? std::atof(argv[2]) : 0.25;
+
+    std::printf("[\n");
+    bool first = true;
+    for (size_t target = 10; target <= max_elements; target *= 10) {
+        Corpus corpus = GenerateCorpus(target);
+        std::vector<double> samples;
+        double total = 0.0;
+        size_t tree_bytes = 0;
+        while (samples.size() < 3 || (total < min_seconds && samples.size() < 1000)) {
+            smlui::UiDocument document;
+            std::string error;
+            auto start = std::chrono::steady_clock::now();
+            bool ok = document.parseFromString(corpus.text, &error);
+            auto end = std::chrono::steady_clock::now();
+            if (!ok) {
+                std::fprintf(stderr, "parse failed at %zu elements: %s\n", target, error.c_str());
+                return 1;
+            }
+            double seconds = std::chrono::duration<double>(end - start).count();
+            samples.push_back(seconds);
+            total += seconds;
+            tree_bytes = document.snapshot()->tree.memoryUsage();
+        }
+        std::sort(samples.begin(), samples.end());
+        double median = samples[samples.size() / 2];
+        double mb = (double)corpus.text.size() / (1024.0 * 1024.0);
+        std::printf("%s  {\"elements\": %zu, \"bytes\": %zu, \"runs\": %zu, \"median_ms\": %.4f, "
+                    "\"mb_per_s\": %.2f, \"elements_per_s\": %.0f, \"tree_kb\": %zu, \"peak_rss_kb\": %ld}",
+                    first ? "" : ",\n", corpus.elements, corpus.text.size(), samples.size(),
+                    median * 1000.0, mb / median, (double)corpus.elements / median, tree_bytes / 1024,
+                    PeakRssKb());
+        first = false;
+    }
+    std::printf("\n]\n");
+    return 0;
+}
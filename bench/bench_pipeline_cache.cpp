@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Cold vs. warm pipeline creation with UiPipelineCache.
+//
+//   smlui_bench_pipeline_cache [cache_file]
+//
+// Deletes the cache file, then runs ImGui_ImplVulkan_Init() twice on a
+// headless Vulkan device: once with an empty cache that is saved
+// afterwards, once with the cache loaded from that file. Prints both
+// creation times and the time saved as JSON. Drivers keep their own
+// shader caches, which hide most of the difference; disable them for a
+// real cold start (MESA_SHADER_CACHE_DISABLE=true, __GL_SHADER_DISK_CACHE=0).
+
+#include "bench_vulkan.h"
+#include "sml_ui_pipeline_cache.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+bool RunOnce(bench::VulkanBench& vk, const std::string& path, smlui::UiPipelineCacheStats* stats) {
+    smlui::UiPipelineCache cache;
+    std::string error;
+    if (!cache.load(vk.physicalDevice(), vk.device(), path, nullptr, &error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return false;
+    }
+    ImGui_ImplVulkan_InitInfo init_info = {};
+    vk.fillInitInfo(&init_info);
+    init_info.PipelineCache = cache.handle();
+    cache.beginCreation();
+    ImGui_ImplVulkan_Init(&init_info);
+    cache.endCreation();
+    ImGui_ImplVulkan_Shutdown();
+    if (!cache.save(&error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return false;
+    }
+    *stats = cache.stats();
+    cache.destroy();
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string path = argc > 1 ? argv[1] : "smlui_bench.pipeline_cache";
+    std::remove(path.c_str());
+
+    bench::VulkanBench vk;
+    if (!vk.init(64, 64))
+        return 1;
+    ImGui::CreateContext();
+
+    smlui::UiPipelineCacheStats cold, warm;
+    if (!RunOnce(vk, path, &cold) || !RunOnce(vk, path, &warm))
+        return 1;
+
+    std::printf("{\n    \"cold_ms\": %.3f, \"warm_ms\": %.3f, \"saved_ms\": %.3f,\n", cold.create_ms, warm.create_ms,
+                warm.saved_ms);
+    std::printf("    \"warm\": %s, \"rejected\": \"%s\", \"loaded_bytes\": %d, \"saved_bytes\": %d\n}\n",
+                warm.warm ? "true" : "false", warm.rejected.c_str(), (int)warm.loaded_bytes, (int)cold.saved_bytes);
+
+    ImGui::DestroyContext();
+    vk.shutdown();
+    return vk.validationErrors() > 0 ? 1 : 0;
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Frame times of UiDocument::render while another thread publishes new
+// models, the way UiLayoutWatcher does on hot reload.
+//
+//   smlui_bench_reload [frames] [tools]
+//
+// Headless like smlui_bench_render. A publisher thread parses two
+// variants of an editor layout into a private document and hands them
+// over with publish(), either back to back or every 10 ms; the main
+// thread keeps rendering. The watch_file case instead rewrites a real
+// file every 50 ms, alternating in-place writes and rename-over saves,
+// and lets a UiLayoutWatcher pick the changes up through inotify and its
+// debounce; it renders until the watcher has reloaded a few times.
+//
+// For each case the benchmark prints one JSON object with NewFrame +
+// render + ImGui::Render times (p50/p99/max), the number of models
+// published during the run and p99/max relative to the idle case. It
+// exits with 1 if a case exceeds kMaxP99Ratio or kMaxMaxRatio (checked
+// only with more than one hardware thread), or if the watcher never
+// reloaded.
+
+#include "sml_ui.h"
+#include "sml_ui_reload.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Publishing may cost the render thread some cache misses, but no frame
+// should wait on a parse. The floors keep short idle frames and a lucky
+// idle max from turning scheduler noise into a failure.
+const double kMaxP99Ratio = 2.0;
+const double kMaxMaxRatio = 4.0;
+const double kP99FloorMs = 0.1;
+const double kMaxFloorMs = 2.0;
+const int kWatchIntervalMs = 50;
+const unsigned kWatchMinReloads = 5;
+const int kWatchTimeoutMs = 5000;
+
+std::string BuildLayout(const char* title, int tools) {
+    std::string text = "Window {\n    title: \"";
+    text += title;
+    text += "\"\n    size: 1280,720\n    DockLayout {\n        Top { height: 40 ToolBar {\n";
+    for (int i = 0; i < tools; ++i)
+        text += "            ToolButton { icon: select }\n";
+    text += "        } }\n        Left { label: \"Tools\" width: 56\n";
+    for (int i = 0; i < tools; ++i)
+        text += "            ToolButton { icon: paint }\n";
+    text += "        }\n        Right { label: \"Properties\" width: 360 PropertyPanel { } }\n"
+            "        Center { label: \"Viewport\" Viewport3D { } }\n"
+            "        Bottom { height: 24 StatusBar { } }\n    }\n}\n";
+    return text;
+}
+
+enum class Source { None, Publish, WatchFile };
+
+struct Case {
+    const char* name;
+    Source source;
+    int interval_ms;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+double Percentile(const std::vector<double>& sorted, double p) {
+    return sorted.empty() ? 0.0 : sorted[(size_t)(p * (double)(sorted.size() - 1))];
+}
+
+bool WriteFile(const std::string& path, const std::string& text) {
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    out << text;
+    return (bool)out;
+}
+
+// Two writes in place, then two the way editors save: a temp file renamed
+// over the original. Both variants see both kinds of save.
+bool SaveLayout(const std::string& path, const std::string& text, unsigned n) {
+    if ((n & 2) == 0)
+        return WriteFile(path, text);
+    const std::string temp = path + ".tmp";
+    return WriteFile(temp, text) && std::rename(temp.c_str(), path.c_str()) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 5000;
+    int tools = argc > 2 ? std::atoi(argv[2]) : 200;
+    const int warmup_frames = 10;
+
+    const std::string variants[2] = {BuildLayout("Reload A", tools), BuildLayout("Reload B", tools)};
+    const Case cases[] = {
+        {"idle", Source::None, 0},
+        {"publish_10ms", Source::Publish, 10},
+        {"publish_continuous", Source::Publish, 0},
+        {"watch_file", Source::WatchFile, kWatchIntervalMs},
+    };
+
+#if defined(_WIN32)
+    std::string directory = ".";
+#else
+    char directory_template[] = "/tmp/smlui_bench_reload.XXXXXX";
+    if (!mkdtemp(directory_template)) {
+        std::fprintf(stderr, "cannot create temporary directory\n");
+        return 1;
+    }
+    std::string directory = directory_template;
+#endif
+    const std::string layout_path = directory + "/layout.sml";
+
+    const bool timing_checked = std::thread::hardware_concurrency() > 1;
+    if (!timing_checked)
+        std::fprintf(stderr, "single hardware thread: frame time ratios are reported, not checked\n");
+    double idle_p99 = 0.0;
+    double idle_max = 0.0;
+    bool passed = true;
+    std::printf("[\n");
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+        const Source source = cases[c].source;
+        smlui::UiDocument document;
+        std::string error;
+        if (!document.parseFromString(variants[0], &error)) {
+            std::fprintf(stderr, "%s: %s\n", cases[c].name, error.c_str());
+            return 1;
+        }
+
+        ImGuiContext* context = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.IniFilename = nullptr;
+        io.Fonts->Build();
+
+        std::atomic<bool> stop{false};
+        std::atomic<unsigned> published{0};
+        std::atomic<unsigned> failed{0};
+        smlui::UiLayoutWatcher watcher;
+        std::thread publisher;
+        const int interval_ms = cases[c].interval_ms;
+        if (source == Source::Publish) {
+            publisher = std::thread([&]() {
+                for (unsigned n = 1; !stop.load(); ++n) {
+                    smlui::UiDocument fresh;
+                    fresh.setSchema(document.schema());
+                    std::string parse_error;
+                    if (!fresh.parseFromString(variants[n & 1], &parse_error)) {
+                        ++failed;
+                        break;
+                    }
+                    document.publish(fresh.snapshot());
+                    ++published;
+                    if (interval_ms > 0)
+                        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+                }
+            });
+        } else if (source == Source::WatchFile) {
+            if (!WriteFile(layout_path, variants[0]) || !watcher.watch(&document, layout_path, &error)) {
+                std::fprintf(stderr, "%s: %s\n", cases[c].name, error.empty() ? "cannot write layout" : error.c_str());
+                std::remove(layout_path.c_str());
+                return 1;
+            }
+            publisher = std::thread([&]() {
+                for (unsigned n = 1; !stop.load(); ++n) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+                    if (!SaveLayout(layout_path, variants[n & 1], n))
+                        ++failed;
+                }
+            });
+        }
+
+        std::vector<double> frame_ms;
+        frame_ms.reserve(frames);
+        const Clock::time_point start = Clock::now();
+        for (int f = 0;; ++f) {
+            if (f >= warmup_frames + frames) {
+                // Rendering alone is faster than the file round trip; keep
+                // going until the watcher has had a chance to reload.
+                if (source != Source::WatchFile || watcher.reloadCount() >= kWatchMinReloads ||
+                    Clock::now() - start > std::chrono::milliseconds(kWatchTimeoutMs))
+                    break;
+            }
+            Clock::time_point t0 = Clock::now();
+            ImGui::NewFrame();
+            bool play_clicked = false;
+            document.render(ImGui::GetMainViewport(), nullptr, &play_clicked);
+            ImGui::Render();
+            Clock::time_point t1 = Clock::now();
+            if (f >= warmup_frames)
+                frame_ms.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        }
+        stop = true;
+        if (publisher.joinable())
+            publisher.join();
+        watcher.stop();
+        if (source == Source::WatchFile)
+            published = watcher.reloadCount();
+        ImGui::DestroyContext(context);
+        if (failed.load() > 0) {
+            std::fprintf(stderr, "%s: publisher failed to %s\n", cases[c].name,
+                         source == Source::WatchFile ? "write the layout" : "parse");
+            return 1;
+        }
+
+        std::sort(frame_ms.begin(), frame_ms.end());
+        const double p99 = Percentile(frame_ms, 0.99);
+        const double max = frame_ms.empty() ? 0.0 : frame_ms.back();
+        if (source == Source::None) {
+            idle_p99 = std::max(p99, kP99FloorMs);
+            idle_max = std::max(max, kMaxFloorMs);
+        }
+        const double p99_ratio = idle_p99 > 0.0 ? p99 / idle_p99 : 0.0;
+        const double max_ratio = idle_max > 0.0 ? max / idle_max : 0.0;
+        // With a single hardware thread every parse preempts the render
+        // thread, so the ratios say nothing about the swap itself.
+        bool ok = !timing_checked || (p99_ratio <= kMaxP99Ratio && max_ratio <= kMaxMaxRatio);
+        if (source == Source::WatchFile && watcher.reloadCount() == 0) {
+            std::fprintf(stderr, "%s: the watcher never reloaded\n", cases[c].name);
+            ok = false;
+        }
+        passed = passed && ok;
+        std::printf("%s  {\"case\": \"%s\", \"frames\": %zu, \"tools\": %d, \"published\": %u, "
+                    "\"failed_reloads\": %u, \"p50_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f, "
+                    "\"p99_ratio\": %.2f, \"max_ratio\": %.2f, \"pass\": %s}",
+                    c == 0 ? "" : ",\n", cases[c].name, frame_ms.size(), tools, published.load(),
+                    watcher.failedReloadCount(), Percentile(frame_ms, 0.5), p99, max, p99_ratio, max_ratio,
+                    ok ? "true" : "false");
+    }
+    std::printf("\n]\n");
+
+    std::remove(layout_path.c_str());
+    std::remove((layout_path + ".tmp").c_str());
+#if !defined(_WIN32)
+    rmdir(directory.c_str());
+#endif
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headless CPU cost of UiDocument::render + ImGui::Render.
+//
+//   smlui_bench_render [frames]
+//
+// No GPU and no platform backend: the ImGui context gets a fixed display
+// size and a font atlas built up front. For each layout the benchmark
+// prints one JSON object with per-phase timings (NewFrame, render,
+// ImGui::Render), draw data sizes and heap allocations per frame, counted
+// both through ImGui::SetAllocatorFunctions and a global operator new.
+// Exits with 1 if any frame after the warm-up allocated.
+
+#include "sml_ui.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+// Counts every C++ heap allocation in the process, including those made
+// by smlui outside of ImGui's allocator.
+static std::atomic<size_t> g_new_allocations{0};
+
+void* operator new(size_t size) {
+    ++g_new_allocations;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    ++g_new_allocations;
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+#endif
+
+namespace {
+
+struct Layout {
+    const char* name;
+    std::string text;
+};
+
+std::vector<Layout> BuildLayouts() {
+    std::vector<Layout> layouts;
+    layouts.push_back(Layout{"label", R"(Window {
+    title: "Label"
+    Label { text: "Hello SMLUI" position: 20,20 }
+})"});
+    layouts.push_back(Layout{"editor", R"(Window {
+    title: "RaidBuilder"
+    size: 1280,720
+    MainMenu {
+        Menu { label: "File"
+            MenuItem { label: "Open" action: open }
+            MenuItem { label: "Save" action: save }
+            Separator { }
+            MenuItem { label: "Exit" clicked: "exit" }
+        }
+        Menu { label: "Edit" MenuItem { label: "Undo" clicked: "undo" } }
+    }
+    DockLayout {
+        Top { height: 40 ToolBar { ToolButton { icon: play } ToolButton { icon: select } ToolButton { icon: move } } }
+        Left { label: "Tools" width: 56 ToolButton { icon: select } ToolButton { icon: move } ToolButton { icon: paint } }
+        Right { label: "Properties" width: 360 PropertyPanel { } }
+        Center { label: "Viewport" Viewport3D { } }
+        Bottom { height: 24 StatusBar { } }
+    }
+})"});
+    std::string toolbar = "Window {\n    title: \"Toolbar\"\n    DockLayout {\n        Top { height: 40 ToolBar {\n";
+    for (int i = 0; i < 200; ++i)
+        toolbar += "            ToolButton { icon: select }\n";
+    toolbar += "        } }\n        Left { label: \"Tools\" width: 56\n";
+    for (int i = 0; i < 200; ++i)
+        toolbar += "            ToolButton { icon: paint }\n";
+    toolbar += "        }\n        Center { label: \"Viewport\" }\n    }\n}\n";
+    layouts.push_back(Layout{"toolbar_400", toolbar});
+    return layouts;
+}
+
+size_t g_allocations = 0;
+
+void* CountingAlloc(size_t size, void* user_data) {
+    (void)user_data;
+    ++g_allocations;
+    return std::malloc(size);
+}
+
+void CountingFree(void* ptr, void* user_data) {
+    (void)user_data;
+    std::free(ptr);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double Micros(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+double Median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const int warmup_frames = 10;
+    ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree, nullptr);
+
+    std::vector<Layout> layouts = BuildLayouts();
+    int failed_layouts = 0;
+    std::printf("[\n");
+    for (size_t l = 0; l < layouts.size(); ++l) {
+        smlui::UiDocument document;
+        std::string error;
+        if (!document.parseFromString(layouts[l].text, &error)) {
+            std::fprintf(stderr, "%s: %s\n", layouts[l].name, error.c_str());
+            return 1;
+        }
+
+        ImGuiContext* context = ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.IniFilename = nullptr;
+        io.Fonts->Build();
+
+        std::vector<double> new_frame_us, render_us, imgui_render_us;
+        size_t allocations = 0;
+        size_t new_allocations = 0;
+        int allocating_frames = 0;
+        ImDrawData* draw_data = nullptr;
+        for (int f = 0; f < warmup_frames + frames; ++f) {
+            size_t allocations_before = g_allocations;
+            size_t new_allocations_before = g_new_allocations.load();
+            Clock::time_point t0 = Clock::now();
+            ImGui::NewFrame();
+            Clock::time_point t1 = Clock::now();
+            bool play_clicked = false;
+            document.render(ImGui::GetMainViewport(), nullptr, &play_clicked);
+            Clock::time_point t2 = Clock::now();
+            ImGui::Render();
+            Clock::time_point t3 = Clock::now();
+            if (f < warmup_frames)
+                continue;
+            size_t frame_allocations = g_allocations - allocations_before;
+            size_t frame_new_allocations = g_new_allocations.load() - new_allocations_before;
+            allocations += frame_allocations;
+            new_allocations += frame_new_allocations;
+            if (frame_allocations > 0 || frame_new_allocations > 0)
+                ++allocating_frames;
+            new_frame_us.push_back(Micros(t0, t1));
+            render_us.push_back(Micros(t1, t2));
+            imgui_render_us.push_back(Micros(t2, t3));
+            draw_data = ImGui::GetDrawData();
+        }
+
+        int cmd_lists = 0;
+        int draw_cmds = 0;
+        int vtx = 0;
+        int idx = 0;
+        if (draw_data) {
+            cmd_lists = draw_data->CmdListsCount;
+            vtx = draw_data->TotalVtxCount;
+            idx = draw_data->TotalIdxCount;
+            for (int i = 0; i < draw_data->CmdLists.Size; ++i)
+                draw_cmds += draw_data->CmdLists[i]->CmdBuffer.Size;
+        }
+        std::printf("%s  {\"layout\": \"%s\", \"frames\": %d, \"new_frame_us\": %.2f, \"render_us\": %.2f, "
+                    "\"imgui_render_us\": %.2f, \"cmd_lists\": %d, \"draw_cmds\": %d, \"total_vtx\": %d, "
+                    "\"total_idx\": %d, \"allocs_per_frame\": %.3f, \"new_per_frame\": %.3f, "
+                    "\"allocating_frames\": %d}",
+                    l == 0 ? "" : ",\n", layouts[l].name, frames, Median(new_frame_us), Median(render_us),
+                    Median(imgui_render_us), cmd_lists, draw_cmds, vtx, idx,
+                    frames > 0 ? (double)allocations / frames : 0.0,
+                    frames > 0 ? (double)new_allocations / frames : 0.0, allocating_frames);
+        if (allocating_frames > 0) {
+            std::fprintf(stderr, "%s: %d of %d steady-state frames allocated\n", layouts[l].name,
+                         allocating_frames, frames);
+            ++failed_layouts;
+        }
+        ImGui::DestroyContext(context);
+    }
+    std::printf("\n]\n");
+    return failed_layouts > 0 ? 1 : 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Drives the Vulkan backend's upload and draw paths under
+// VK_LAYER_KHRONOS_validation on a headless device.
+//
+//   smlui_bench_validate
+//
+// Every backend configuration (default, UseFrameHash and, when the device
+// supports them, UseMultiDrawIndirect and UseDescriptorIndexing) runs the
+// same script:
+//
+//   grow     rect count doubles every few frames up to 40k: the per-frame
+//            vertex/index buffers grow and move between memory blocks
+//   shrink   8 rects for longer than IMGUI_IMPL_VULKAN_BUFFER_SHRINK_FRAMES
+//            per frame slot, then ImGui_ImplVulkan_CompactMemory()
+//   static   identical frames, reused buffers with UseFrameHash
+//   glyphs   text at a new font size every frame: atlas updates with
+//            several copy regions and atlas growth
+//
+// Prints one JSON object per configuration with the validation errors it
+// produced and exits with 1 if there were any. Needs the validation layer;
+// on CI containers run it on lavapipe
+// (VK_ICD_FILENAMES=.../lvp_icd.x86_64.json).
+
+#include "bench_vulkan.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+enum class Phase { Grow, Shrink, Static, Glyphs };
+
+struct Step {
+    Phase phase;
+    const char* name;
+    int frames;
+};
+
+const Step kScript[] = {
+    {Phase::Grow, "grow", 64},
+    {Phase::Shrink, "shrink", 2 * 300 + 100},
+    {Phase::Static, "static", 120},
+    {Phase::Glyphs, "glyphs", 120},
+};
+
+struct Config {
+    const char* name;
+    bool frame_hash;
+    bool multi_draw_indirect;
+    bool descriptor_indexing;
+};
+
+void BuildFrame(Phase phase, int frame) {
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+    ImGui::Begin("validate", nullptr, ImGuiWindowFlags_NoDecoration);
+    if (phase == Phase::Glyphs) {
+        ImGui::PushFont(nullptr, 10.0f + (float)(frame % 60));
+        ImGui::TextWrapped("The quick brown fox jumps over the lazy dog 0123456789 %d", frame);
+        ImGui::PopFont();
+    } else {
+        ImGui::Text("validate");
+    }
+    ImGui::End();
+
+    int rects = 8;
+    if (phase == Phase::Grow)
+        rects = std::min(40000, 1 << (frame / 4));
+    ImDrawList* draw_list = ImGui::GetForegroundDrawList();
+    for (int i = 0; i < rects; ++i) {
+        // Alternate clip rects so merging has runs to join and to split.
+        if ((i & 63) == 0) {
+            if (i > 0)
+                draw_list->PopClipRect();
+            draw_list->PushClipRect(ImVec2(0.0f, 0.0f), ImVec2(io.DisplaySize.x - (float)((i >> 6) & 1), io.DisplaySize.y));
+        }
+        float x = (float)(i % 200) * 6.0f;
+        float y = (float)((i / 200) % 120) * 6.0f;
+        draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 5.0f, y + 5.0f), IM_COL32(i & 255, 128, 255 - (i & 255), 255));
+    }
+    if (rects > 0)
+        draw_list->PopClipRect();
+    ImGui::Render();
+}
+
+} // namespace
+
+int main() {
+    bench::VulkanBench vk;
+    bench::VulkanBenchOptions options;
+    options.validation = true;
+    options.multi_draw_indirect = true;
+    options.descriptor_indexing = true;
+    if (!vk.init(1280, 720, options))
+        return 1;
+
+    const Config configs[] = {
+        {"default", false, false, false},
+        {"frame_hash", true, false, false},
+        {"multi_draw_indirect", false, true, false},
+        {"descriptor_indexing", false, false, true},
+    };
+    std::printf("[\n");
+    bool first = true;
+    for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); ++c) {
+        const Config& config = configs[c];
+        if (config.multi_draw_indirect && !vk.multiDrawIndirect()) {
+            std::fprintf(stderr, "%s: skipped, no multiDrawIndirect\n", config.name);
+            continue;
+        }
+        if (config.descriptor_indexing && !vk.descriptorIndexing()) {
+            std::fprintf(stderr, "%s: skipped, no Vulkan 1.2 descriptor indexing\n", config.name);
+            continue;
+        }
+        const int errors_before = vk.validationErrors();
+
+        ImGui::CreateContext();
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(1280.0f, 720.0f);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.IniFilename = nullptr;
+        ImGui_ImplVulkan_InitInfo init_info = {};
+        vk.fillInitInfo(&init_info);
+        init_info.UseFrameHash = config.frame_hash;
+        init_info.UseMultiDrawIndirect = config.multi_draw_indirect;
+        init_info.UseDescriptorIndexing = config.descriptor_indexing;
+        ImGui_ImplVulkan_Init(&init_info);
+
+        std::string steps;
+        for (size_t s = 0; s < sizeof(kScript) / sizeof(kScript[0]); ++s) {
+            const int step_errors_before = vk.validationErrors();
+            for (int f = 0; f < kScript[s].frames; ++f) {
+                ImGui_ImplVulkan_NewFrame();
+                BuildFrame(kScript[s].phase, f);
+                VkCommandBuffer command_buffer = vk.beginFrame();
+                ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), command_buffer);
+                vk.endFrame();
+            }
+            if (kScript[s].phase == Phase::Shrink) {
+                vk.waitIdle();
+                ImGui_ImplVulkan_CompactMemory();
+            }
+            char buffer[96];
+            std::snprintf(buffer, sizeof(buffer), "%s\"%s\": %d", s == 0 ? "" : ", ", kScript[s].name,
+                          vk.validationErrors() - step_errors_before);
+            steps += buffer;
+        }
+        vk.waitIdle();
+
+        ImGui_ImplVulkan_MemoryStats memory;
+        ImGui_ImplVulkan_GetMemoryStats(&memory);
+        const ImU64 upload_bytes = ImGui_ImplVulkan_GetUploadStats()->TotalBytes;
+        const ImU64 hash_hits = ImGui_ImplVulkan_GetFrameHashStats()->Hits;
+        ImGui_ImplVulkan_Shutdown();
+        ImGui::DestroyContext();
+
+        std::printf("%s  {\"config\": \"%s\", \"errors\": {%s}, \"upload_bytes\": %llu, \"hash_hits\": %llu, "
+                    "\"memory_blocks\": %d, \"errors_total\": %d}",
+                    first ? "" : ",\n", config.name, steps.c_str(), (unsigned long long)upload_bytes,
+                    (unsigned long long)hash_hits, memory.BlockCount, vk.validationErrors() - errors_before);
+        first = false;
+    }
+    std::printf("\n]\n");
+    vk.shutdown();
+    return vk.validationErrors() > 0 ? 1 : 0;
+}
@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Serial vs. parallel recording of secondary viewports.
+//
+//   smlui_bench_viewports [frames] [rects_per_viewport]
+//
+// Opens 1 to 8 secondary viewports on a headless Vulkan device. A dummy
+// platform backend keeps the window positions and sizes and backs each
+// viewport with a VK_EXT_headless_surface swapchain (lavapipe supports
+// it). Every viewport draws the same number of filled rectangles and text
+// lines. For each viewport count the benchmark runs once with the default
+// inline recording and once with ImGui_ImplVulkan_InitInfo::ParallelForFn
+// on a small thread pool, and prints median and p99 time spent in
+// ImGui::RenderPlatformWindowsDefault() (recording, submit and present)
+// as JSON.
+//
+// With SMLUI_BENCH_VALIDATION=1 the runs go through the validation layer:
+// secondary command buffers continuing the render pass, the single submit
+// and the empty submissions that signal the other viewports' fences.
+// Viewport 0 then also carries a draw callback, which keeps its recording
+// on the calling thread. The JSON gains the error count per run and the
+// benchmark exits with 1 if there were any.
+
+#include "bench_vulkan.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const int kMaxViewports = 8;
+const float kMainWidth = 640.0f;
+const float kMainHeight = 480.0f;
+const float kViewportWidth = 320.0f;
+const float kViewportHeight = 240.0f;
+
+double Micros(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::micro>(b - a).count();
+}
+
+double Percentile(std::vector<double> values, double p) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t i = (size_t)(p * (double)(values.size() - 1));
+    return values[i];
+}
+
+// Runs the jobs of one ParallelFor() call on persistent workers; the
+// calling thread takes jobs too and returns once all of them are done.
+class JobPool {
+public:
+    explicit JobPool(unsigned worker_count) {
+        for (unsigned i = 0; i < worker_count; ++i)
+            workers_.push_back(std::thread(&JobPool::workerLoop, this));
+    }
+
+    ~JobPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            quit_ = true;
+        }
+        wake_.notify_all();
+        for (size_t i = 0; i < workers_.size(); ++i)
+            workers_[i].join();
+    }
+
+    void run(int job_count, void (*job)(int, void*), void* job_data) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = job;
+            job_data_ = job_data;
+            job_count_ = job_count;
+            next_.store(0);
+            remaining_ = job_count;
+            ++generation_;
+        }
+        wake_.notify_all();
+        work();
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return remaining_ == 0; });
+    }
+
+    unsigned workerCount() const { return (unsigned)workers_.size(); }
+
+private:
+    void work() {
+        int finished = 0;
+        for (int i = next_.fetch_add(1); i < job_count_; i = next_.fetch_add(1)) {
+            job_(i, job_data_);
+            ++finished;
+        }
+        if (finished == 0)
+            return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        remaining_ -= finished;
+        if (remaining_ == 0)
+            done_.notify_all();
+    }
+
+    void workerLoop() {
+        unsigned seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this, seen] { return quit_ || generation_ != seen; });
+                if (quit_)
+                    return;
+                seen = generation_;
+            }
+            work();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    bool quit_ = false;
+    unsigned generation_ = 0;
+    void (*job_)(int, void*) = nullptr;
+    void* job_data_ = nullptr;
+    int job_count_ = 0;
+    std::atomic<int> next_{0};
+    int remaining_ = 0;
+};
+
+JobPool* g_pool = nullptr;
+bench::VulkanBench* g_vk = nullptr;
+
+void ParallelFor(int job_count, void (*job)(int, void*), void* job_data) {
+    g_pool->run(job_count, job, job_data);
+}
+
+// Dummy platform backend: windows are a position and a size.
+struct PlatformWindow {
+    ImVec2 pos;
+    ImVec2 size;
+};
+
+PlatformWindow* GetPlatformWindow(ImGuiViewport* viewport) {
+    return (PlatformWindow*)viewport->PlatformUserData;
+}
+
+void PlatformCreateWindow(ImGuiViewport* viewport) {
+    PlatformWindow* window = new PlatformWindow;
+    window->pos = viewport->Pos;
+    window->size = viewport->Size;
+    viewport->PlatformUserData = window;
+}
+
+void PlatformDestroyWindow(ImGuiViewport* viewport) {
+    delete GetPlatformWindow(viewport);
+    viewport->PlatformUserData = nullptr;
+    viewport->PlatformHandle = nullptr;
+}
+
+void PlatformShowWindow(ImGuiViewport*) {}
+
+void PlatformSetWindowPos(ImGuiViewport* viewport, ImVec2 pos) {
+    if (PlatformWindow* window = GetPlatformWindow(viewport))
+        window->pos = pos;
+}
+
+ImVec2 PlatformGetWindowPos(ImGuiViewport* viewport) {
+    PlatformWindow* window = GetPlatformWindow(viewport);
+    return window ? window->pos : ImVec2(0.0f, 0.0f);
+}
+
+void PlatformSetWindowSize(ImGuiViewport* viewport, ImVec2 size) {
+    if (PlatformWindow* window = GetPlatformWindow(viewport))
+        window->size = size;
+}
+
+ImVec2 PlatformGetWindowSize(ImGuiViewport* viewport) {
+    PlatformWindow* window = GetPlatformWindow(viewport);
+    return window ? window->size : ImVec2(kMainWidth, kMainHeight);
+}
+
+bool PlatformGetWindowFocus(ImGuiViewport*) { return false; }
+bool PlatformGetWindowMinimized(ImGuiViewport*) { return false; }
+
+int PlatformCreateVkSurface(ImGuiViewport*, ImU64, const void* allocator, ImU64* out_surface) {
+    VkSurfaceKHR surface = VK_NULL_HANDLE;
+    VkResult err = g_vk->createHeadlessSurface((const VkAllocationCallbacks*)allocator, &surface);
+    *out_surface = (ImU64)surface;
+    return (int)err;
+}
+
+void InstallPlatformBackend() {
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendFlags |= ImGuiBackendFlags_PlatformHasViewports;
+    io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+    io.ConfigViewportsNoAutoMerge = true;
+    io.ConfigViewportsNoTaskBarIcon = true;
+
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Platform_CreateWindow = PlatformCreateWindow;
+    platform_io.Platform_DestroyWindow = PlatformDestroyWindow;
+    platform_io.Platform_ShowWindow = PlatformShowWindow;
+    platform_io.Platform_SetWindowPos = PlatformSetWindowPos;
+    platform_io.Platform_GetWindowPos = PlatformGetWindowPos;
+    platform_io.Platform_SetWindowSize = PlatformSetWindowSize;
+    platform_io.Platform_GetWindowSize = PlatformGetWindowSize;
+    platform_io.Platform_GetWindowFocus = PlatformGetWindowFocus;
+    platform_io.Platform_GetWindowMinimized = PlatformGetWindowMinimized;
+    platform_io.Platform_CreateVkSurface = PlatformCreateVkSurface;
+
+    ImGuiPlatformMonitor monitor;
+    monitor.MainPos = monitor.WorkPos = ImVec2(0.0f, 0.0f);
+    monitor.MainSize = monitor.WorkSize = ImVec2(4096.0f, 4096.0f);
+    platform_io.Monitors.push_back(monitor);
+}
+
+void BuildViewports(int viewport_count, int rects, bool with_callback) {
+    for (int v = 0; v < viewport_count; ++v) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "viewport %d", v);
+        ImVec2 pos(kMainWidth + 16.0f + (float)(v % 4) * (kViewportWidth + 16.0f),
+                   (float)(v / 4) * (kViewportHeight + 16.0f));
+        ImGui::SetNextWindowPos(pos);
+        ImGui::SetNextWindowSize(ImVec2(kViewportWidth, kViewportHeight));
+        ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoDecoration);
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        ImVec2 origin = ImGui::GetCursorScreenPos();
+        for (int i = 0; i < rects; ++i) {
+            float x = origin.x + (float)((i * 7) % 300);
+            float y = origin.y + (float)((i * 13) % 220);
+            draw_list->AddRectFilled(ImVec2(x, y), ImVec2(x + 6.0f, y + 6.0f), IM_COL32((i * 37) & 0xFF, (i * 11) & 0xFF, 200, 255));
+        }
+        for (int i = 0; i < 12; ++i)
+            ImGui::Text("row %d of viewport %d", i, v);
+        if (with_callback && v == 0)
+            draw_list->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+        ImGui::End();
+    }
+}
+
+std::vector<double> Run(bench::VulkanBench& vk, bool parallel, int viewport_count, int frames, int rects) {
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(kMainWidth, kMainHeight);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = nullptr;
+    InstallPlatformBackend();
+    ImGui_ImplVulkan_InitInfo init_info = {};
+    vk.fillInitInfo(&init_info);
+    if (parallel)
+        init_info.ParallelForFn = ParallelFor;
+    ImGui_ImplVulkan_Init(&init_info);
+
+    const int warmup_frames = 10;
+    std::vector<double> render_us;
+    for (int f = 0; f < warmup_frames + frames; ++f) {
+        ImGui_ImplVulkan_NewFrame();
+        ImGui::NewFrame();
+        BuildViewports(viewport_count, rects, vk.validation());
+        ImGui::Render();
+
+        VkCommandBuffer command_buffer = vk.beginFrame();
+        ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), command_buffer);
+        vk.endFrame();
+
+        ImGui::UpdatePlatformWindows();
+        Clock::time_point t0 = Clock::now();
+        ImGui::RenderPlatformWindowsDefault();
+        Clock::time_point t1 = Clock::now();
+        if (f >= warmup_frames)
+            render_us.push_back(Micros(t0, t1));
+    }
+    vk.waitIdle();
+
+    ImGui_ImplVulkan_Shutdown();
+    ImGui::DestroyContext();
+    return render_us;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 500;
+    int rects = argc > 2 ? std::atoi(argv[2]) : 5000;
+
+    bench::VulkanBench vk;
+    bench::VulkanBenchOptions options;
+    options.headless_surfaces = true;
+    if (!vk.init((uint32_t)kMainWidth, (uint32_t)kMainHeight, options))
+        return 1;
+    g_vk = &vk;
+    unsigned threads = std::thread::hardware_concurrency();
+    JobPool pool(threads > 1 ? std::min(threads - 1, (unsigned)kMaxViewports - 1) : 1);
+    g_pool = &pool;
+
+    std::printf("{\n    \"frames\": %d, \"rects_per_viewport\": %d, \"workers\": %u,\n    \"viewports\": [\n", frames,
+                rects, pool.workerCount());
+    for (int n = 1; n <= kMaxViewports; ++n) {
+        int errors_before = vk.validationErrors();
+        std::vector<double> serial = Run(vk, false, n, frames, rects);
+        int serial_errors = vk.validationErrors() - errors_before;
+        errors_before = vk.validationErrors();
+        std::vector<double> parallel = Run(vk, true, n, frames, rects);
+        int parallel_errors = vk.validationErrors() - errors_before;
+        double serial_p50 = Percentile(serial, 0.5);
+        double parallel_p50 = Percentile(parallel, 0.5);
+        std::printf("        {\"count\": %d, \"serial_p50_us\": %.1f, \"serial_p99_us\": %.1f, \"parallel_p50_us\": %.1f, "
+                    "\"parallel_p99_us\": %.1f, \"speedup\": %.2f",
+                    n, serial_p50, Percentile(serial, 0.99), parallel_p50, Percentile(parallel, 0.99),
+                    parallel_p50 > 0.0 ? serial_p50 / parallel_p50 : 0.0);
+        if (vk.validation())
+            std::printf(", \"serial_errors\": %d, \"parallel_errors\": %d", serial_errors, parallel_errors);
+        std::printf("}%s\n", n < kMaxViewports ? "," : "");
+    }
+    std::printf("    ]\n}\n");
+
+    vk.shutdown();
+    return vk.validationErrors() > 0 ? 1 : 0;
+}
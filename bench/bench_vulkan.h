@@ -0,0 +1,452 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headless Vulkan setup shared by the GPU benchmarks: instance, device,
+// one graphics queue and an offscreen color target with a render pass.
+// No surface and no swapchain, so the benchmarks also run on lavapipe
+// (VK_ICD_FILENAMES=.../lvp_icd.x86_64.json) in CI containers.
+//
+// Frames go through BenchFrame: BeginFrame() waits for the slot's fence
+// and opens the render pass, EndFrame() closes it and submits.
+//
+// VulkanBenchOptions::headless_surfaces also enables VK_EXT_headless_surface
+// and VK_KHR_swapchain so createHeadlessSurface() can back secondary
+// viewports with swapchains.
+//
+// With VulkanBenchOptions::validation or SMLUI_BENCH_VALIDATION=1 in the
+// environment, the instance loads VK_LAYER_KHRONOS_validation and counts
+// its messages through VK_EXT_debug_utils; init() fails when the layer is
+// missing. Benchmarks exit non-zero when validationErrors() is not 0, e.g.
+// on lavapipe:
+//
+//   VK_ICD_FILENAMES=.../lvp_icd.x86_64.json SMLUI_BENCH_VALIDATION=1 ./build/smlui_bench_glyph_upload
+
+#pragma once
+
+#include "imgui.h"
+#include "imgui_impl_vulkan.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace bench {
+
+inline void CheckVk(VkResult err) {
+    if (err == VK_SUCCESS)
+        return;
+    std::fprintf(stderr, "vulkan error %d\n", (int)err);
+    if (err < 0)
+        std::abort();
+}
+
+struct BenchFrame {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+};
+
+struct VulkanBenchOptions {
+    bool headless_surfaces = false;     // VK_EXT_headless_surface and VK_KHR_swapchain
+    bool validation = false;            // also enabled by SMLUI_BENCH_VALIDATION=1
+    bool multi_draw_indirect = false;   // enabled when the device supports it, see multiDrawIndirect()
+    bool descriptor_indexing = false;   // Vulkan 1.2 features for UseDescriptorIndexing, if supported, see descriptorIndexing()
+};
+
+class VulkanBench {
+public:
+    static const uint32_t kFramesInFlight = 2;
+
+    bool init(uint32_t width, uint32_t height, const VulkanBenchOptions& options = VulkanBenchOptions()) {
+        width_ = width;
+        height_ = height;
+        const char* env_validation = std::getenv("SMLUI_BENCH_VALIDATION");
+        validation_ = options.validation || (env_validation && std::strcmp(env_validation, "0") != 0);
+        const char* validation_layer = "VK_LAYER_KHRONOS_validation";
+        std::vector<const char*> instance_extensions;
+        std::vector<const char*> device_extensions;
+        if (options.headless_surfaces) {
+            instance_extensions.push_back("VK_KHR_surface");
+            instance_extensions.push_back("VK_EXT_headless_surface");
+            device_extensions.push_back("VK_KHR_swapchain");
+        }
+        if (validation_) {
+            if (!HasInstanceLayer(validation_layer)) {
+                std::fprintf(stderr, "validation requested but %s is not installed\n", validation_layer);
+                return false;
+            }
+            instance_extensions.push_back("VK_EXT_debug_utils");
+        }
+
+        VkApplicationInfo app = {};
+        app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        app.pApplicationName = "smlui_bench";
+        api_version_ = options.descriptor_indexing ? VK_API_VERSION_1_2 : VK_API_VERSION_1_0;
+        app.apiVersion = api_version_;
+        VkInstanceCreateInfo instance_info = {};
+        instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instance_info.pApplicationInfo = &app;
+        instance_info.enabledExtensionCount = (uint32_t)instance_extensions.size();
+        instance_info.ppEnabledExtensionNames = instance_extensions.empty() ? nullptr : instance_extensions.data();
+        if (validation_) {
+            instance_info.enabledLayerCount = 1;
+            instance_info.ppEnabledLayerNames = &validation_layer;
+        }
+        if (vkCreateInstance(&instance_info, nullptr, &instance_) != VK_SUCCESS) {
+            std::fprintf(stderr, "no vulkan instance\n");
+            return false;
+        }
+        if (validation_)
+            createMessenger();
+
+        uint32_t gpu_count = 0;
+        vkEnumeratePhysicalDevices(instance_, &gpu_count, nullptr);
+        std::vector<VkPhysicalDevice> gpus(gpu_count);
+        vkEnumeratePhysicalDevices(instance_, &gpu_count, gpus.data());
+        for (uint32_t g = 0; g < gpu_count && physical_device_ == VK_NULL_HANDLE; ++g) {
+            uint32_t family_count = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(gpus[g], &family_count, nullptr);
+            std::vector<VkQueueFamilyProperties> families(family_count);
+            vkGetPhysicalDeviceQueueFamilyProperties(gpus[g], &family_count, families.data());
+            for (uint32_t f = 0; f < family_count; ++f) {
+                if (families[f].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+                    physical_device_ = gpus[g];
+                    queue_family_ = f;
+                    break;
+                }
+            }
+        }
+        if (physical_device_ == VK_NULL_HANDLE) {
+            std::fprintf(stderr, "no vulkan device with a graphics queue\n");
+            return false;
+        }
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physical_device_, &properties);
+        std::fprintf(stderr, "device: %s%s\n", properties.deviceName, validation_ ? " (validation)" : "");
+        VkPhysicalDeviceFeatures supported = {};
+        vkGetPhysicalDeviceFeatures(physical_device_, &supported);
+        VkPhysicalDeviceFeatures2 features = {};
+        features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        multi_draw_indirect_ = options.multi_draw_indirect && supported.multiDrawIndirect;
+        features.features.multiDrawIndirect = multi_draw_indirect_ ? VK_TRUE : VK_FALSE;
+        VkPhysicalDeviceDescriptorIndexingFeatures indexing = {};
+        indexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        if (options.descriptor_indexing && properties.apiVersion >= VK_API_VERSION_1_2) {
+            VkPhysicalDeviceFeatures2 supported2 = {};
+            supported2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            supported2.pNext = &indexing;
+            vkGetPhysicalDeviceFeatures2(physical_device_, &supported2);
+            descriptor_indexing_ = indexing.descriptorBindingPartiallyBound && indexing.descriptorBindingSampledImageUpdateAfterBind &&
+                                   indexing.descriptorBindingUpdateUnusedWhilePending && supported.shaderSampledImageArrayDynamicIndexing;
+        }
+        if (descriptor_indexing_) {
+            // Enable only what the backend needs.
+            indexing = VkPhysicalDeviceDescriptorIndexingFeatures();
+            indexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+            indexing.descriptorBindingPartiallyBound = VK_TRUE;
+            indexing.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            indexing.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+            features.features.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+            features.pNext = &indexing;
+        }
+
+        const float priority = 1.0f;
+        VkDeviceQueueCreateInfo queue_info = {};
+        queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_info.queueFamilyIndex = queue_family_;
+        queue_info.queueCount = 1;
+        queue_info.pQueuePriorities = &priority;
+        VkDeviceCreateInfo device_info = {};
+        device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        device_info.queueCreateInfoCount = 1;
+        device_info.pQueueCreateInfos = &queue_info;
+        device_info.enabledExtensionCount = (uint32_t)device_extensions.size();
+        device_info.ppEnabledExtensionNames = device_extensions.empty() ? nullptr : device_extensions.data();
+        // VkPhysicalDeviceFeatures2 in pNext needs Vulkan 1.1, which only the descriptor indexing setup asks for.
+        if (descriptor_indexing_)
+            device_info.pNext = &features;
+        else
+            device_info.pEnabledFeatures = &features.features;
+        CheckVk(vkCreateDevice(physical_device_, &device_info, nullptr, &device_));
+        vkGetDeviceQueue(device_, queue_family_, 0, &queue_);
+
+        createTarget();
+        for (uint32_t i = 0; i < kFramesInFlight; ++i) {
+            VkCommandPoolCreateInfo pool_info = {};
+            pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            pool_info.queueFamilyIndex = queue_family_;
+            CheckVk(vkCreateCommandPool(device_, &pool_info, nullptr, &frames_[i].pool));
+            VkCommandBufferAllocateInfo alloc_info = {};
+            alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            alloc_info.commandPool = frames_[i].pool;
+            alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            alloc_info.commandBufferCount = 1;
+            CheckVk(vkAllocateCommandBuffers(device_, &alloc_info, &frames_[i].command_buffer));
+            VkFenceCreateInfo fence_info = {};
+            fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fence_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+            CheckVk(vkCreateFence(device_, &fence_info, nullptr, &frames_[i].fence));
+        }
+        return true;
+    }
+
+    // Fills the fields of ImGui_ImplVulkan_InitInfo that describe this device.
+    void fillInitInfo(ImGui_ImplVulkan_InitInfo* info) const {
+        info->ApiVersion = api_version_;
+        info->Instance = instance_;
+        info->PhysicalDevice = physical_device_;
+        info->Device = device_;
+        info->QueueFamily = queue_family_;
+        info->Queue = queue_;
+        info->DescriptorPoolSize = IMGUI_IMPL_VULKAN_MINIMUM_IMAGE_SAMPLER_POOL_SIZE;
+        info->MinImageCount = kFramesInFlight;
+        info->ImageCount = kFramesInFlight;
+        info->PipelineInfoMain.RenderPass = render_pass_;
+        info->PipelineInfoMain.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
+        info->CheckVkResultFn = CheckVk;
+    }
+
+    VkCommandBuffer beginFrame() {
+        BenchFrame& frame = frames_[frame_index_];
+        CheckVk(vkWaitForFences(device_, 1, &frame.fence, VK_TRUE, UINT64_MAX));
+        CheckVk(vkResetFences(device_, 1, &frame.fence));
+        CheckVk(vkResetCommandPool(device_, frame.pool, 0));
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        CheckVk(vkBeginCommandBuffer(frame.command_buffer, &begin_info));
+        VkClearValue clear = {};
+        VkRenderPassBeginInfo pass_info = {};
+        pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        pass_info.renderPass = render_pass_;
+        pass_info.framebuffer = framebuffer_;
+        pass_info.renderArea.extent.width = width_;
+        pass_info.renderArea.extent.height = height_;
+        pass_info.clearValueCount = 1;
+        pass_info.pClearValues = &clear;
+        vkCmdBeginRenderPass(frame.command_buffer, &pass_info, VK_SUBPASS_CONTENTS_INLINE);
+        return frame.command_buffer;
+    }
+
+    void endFrame() {
+        BenchFrame& frame = frames_[frame_index_];
+        vkCmdEndRenderPass(frame.command_buffer);
+        CheckVk(vkEndCommandBuffer(frame.command_buffer));
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &frame.command_buffer;
+        CheckVk(vkQueueSubmit(queue_, 1, &submit_info, frame.fence));
+        frame_index_ = (frame_index_ + 1) % kFramesInFlight;
+    }
+
+    void waitIdle() { vkDeviceWaitIdle(device_); }
+
+    // Requires VulkanBenchOptions::headless_surfaces. The surface has no size of its own, swapchains take the requested extent.
+    VkResult createHeadlessSurface(const VkAllocationCallbacks* allocator, VkSurfaceKHR* surface) const {
+        PFN_vkCreateHeadlessSurfaceEXT create =
+            (PFN_vkCreateHeadlessSurfaceEXT)vkGetInstanceProcAddr(instance_, "vkCreateHeadlessSurfaceEXT");
+        if (create == nullptr)
+            return VK_ERROR_EXTENSION_NOT_PRESENT;
+        VkHeadlessSurfaceCreateInfoEXT info = {};
+        info.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+        return create(instance_, &info, allocator, surface);
+    }
+
+    void shutdown() {
+        if (device_ == VK_NULL_HANDLE)
+            return;
+        vkDeviceWaitIdle(device_);
+        for (uint32_t i = 0; i < kFramesInFlight; ++i) {
+            vkDestroyFence(device_, frames_[i].fence, nullptr);
+            vkDestroyCommandPool(device_, frames_[i].pool, nullptr);
+        }
+        vkDestroyFramebuffer(device_, framebuffer_, nullptr);
+        vkDestroyRenderPass(device_, render_pass_, nullptr);
+        vkDestroyImageView(device_, view_, nullptr);
+        vkDestroyImage(device_, image_, nullptr);
+        vkFreeMemory(device_, memory_, nullptr);
+        vkDestroyDevice(device_, nullptr);
+        if (messenger_ != VK_NULL_HANDLE) {
+            PFN_vkDestroyDebugUtilsMessengerEXT destroy =
+                (PFN_vkDestroyDebugUtilsMessengerEXT)vkGetInstanceProcAddr(instance_, "vkDestroyDebugUtilsMessengerEXT");
+            if (destroy)
+                destroy(instance_, messenger_, nullptr);
+            messenger_ = VK_NULL_HANDLE;
+        }
+        vkDestroyInstance(instance_, nullptr);
+        device_ = VK_NULL_HANDLE;
+        if (validation_)
+            std::fprintf(stderr, "validation: %d errors, %d warnings\n", validation_errors_.load(), validation_warnings_.load());
+    }
+
+    // Validation messages so far; the layer may report from any thread.
+    bool validation() const { return validation_; }
+    int validationErrors() const { return validation_errors_.load(); }
+    int validationWarnings() const { return validation_warnings_.load(); }
+    bool multiDrawIndirect() const { return multi_draw_indirect_; }
+    bool descriptorIndexing() const { return descriptor_indexing_; }
+
+    VkInstance instance() const { return instance_; }
+    VkDevice device() const { return device_; }
+    VkPhysicalDevice physicalDevice() const { return physical_device_; }
+    VkQueue queue() const { return queue_; }
+    uint32_t queueFamily() const { return queue_family_; }
+    VkRenderPass renderPass() const { return render_pass_; }
+
+private:
+    static bool HasInstanceLayer(const char* name) {
+        uint32_t count = 0;
+        vkEnumerateInstanceLayerProperties(&count, nullptr);
+        std::vector<VkLayerProperties> layers(count);
+        vkEnumerateInstanceLayerProperties(&count, layers.data());
+        for (uint32_t i = 0; i < count; ++i)
+            if (std::strcmp(layers[i].layerName, name) == 0)
+                return true;
+        return false;
+    }
+
+    static VKAPI_ATTR VkBool32 VKAPI_CALL OnValidationMessage(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type,
+                                                             const VkDebugUtilsMessengerCallbackDataEXT* data, void* user_data) {
+        (void)type;
+        VulkanBench* self = (VulkanBench*)user_data;
+        bool error = (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) != 0;
+        ++(error ? self->validation_errors_ : self->validation_warnings_);
+        std::fprintf(stderr, "validation %s: %s\n", error ? "error" : "warning", data->pMessage);
+        return VK_FALSE;
+    }
+
+    void createMessenger() {
+        PFN_vkCreateDebugUtilsMessengerEXT create =
+            (PFN_vkCreateDebugUtilsMessengerEXT)vkGetInstanceProcAddr(instance_, "vkCreateDebugUtilsMessengerEXT");
+        if (create == nullptr)
+            return;
+        VkDebugUtilsMessengerCreateInfoEXT info = {};
+        info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+        info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        info.pfnUserCallback = OnValidationMessage;
+        info.pUserData = this;
+        CheckVk(create(instance_, &info, nullptr, &messenger_));
+    }
+
+    void createTarget() {
+        VkImageCreateInfo image_info = {};
+        image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        image_info.imageType = VK_IMAGE_TYPE_2D;
+        image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        image_info.extent.width = width_;
+        image_info.extent.height = height_;
+        image_info.extent.depth = 1;
+        image_info.mipLevels = 1;
+        image_info.arrayLayers = 1;
+        image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        image_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        CheckVk(vkCreateImage(device_, &image_info, nullptr, &image_));
+
+        VkMemoryRequirements req;
+        vkGetImageMemoryRequirements(device_, image_, &req);
+        VkPhysicalDeviceMemoryProperties memory_properties;
+        vkGetPhysicalDeviceMemoryProperties(physical_device_, &memory_properties);
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize = req.size;
+        for (uint32_t i = 0; i < memory_properties.memoryTypeCount; ++i) {
+            if (req.memoryTypeBits & (1u << i)) {
+                alloc_info.memoryTypeIndex = i;
+                if (memory_properties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+                    break;
+            }
+        }
+        CheckVk(vkAllocateMemory(device_, &alloc_info, nullptr, &memory_));
+        CheckVk(vkBindImageMemory(device_, image_, memory_, 0));
+
+        VkImageViewCreateInfo view_info = {};
+        view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        view_info.image = image_;
+        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        view_info.subresourceRange.levelCount = 1;
+        view_info.subresourceRange.layerCount = 1;
+        CheckVk(vkCreateImageView(device_, &view_info, nullptr, &view_));
+
+        VkAttachmentDescription attachment = {};
+        attachment.format = VK_FORMAT_R8G8B8A8_UNORM;
+        attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        VkAttachmentReference color_ref = {};
+        color_ref.attachment = 0;
+        color_ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &color_ref;
+        VkRenderPassCreateInfo pass_info = {};
+        pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        pass_info.attachmentCount = 1;
+        pass_info.pAttachments = &attachment;
+        pass_info.subpassCount = 1;
+        pass_info.pSubpasses = &subpass;
+        CheckVk(vkCreateRenderPass(device_, &pass_info, nullptr, &render_pass_));
+
+        VkFramebufferCreateInfo framebuffer_info = {};
+        framebuffer_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebuffer_info.renderPass = render_pass_;
+        framebuffer_info.attachmentCount = 1;
+        framebuffer_info.pAttachments = &view_;
+        framebuffer_info.width = width_;
+        framebuffer_info.height = height_;
+        framebuffer_info.layers = 1;
+        CheckVk(vkCreateFramebuffer(device_, &framebuffer_info, nullptr, &framebuffer_));
+    }
+
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    bool validation_ = false;
+    bool multi_draw_indirect_ = false;
+    bool descriptor_indexing_ = false;
+    uint32_t api_version_ = VK_API_VERSION_1_0;
+    std::atomic<int> validation_errors_{0};
+    std::atomic<int> validation_warnings_{0};
+    VkInstance instance_ = VK_NULL_HANDLE;
+    VkDebugUtilsMessengerEXT messenger_ = VK_NULL_HANDLE;
+    VkPhysicalDevice physical_device_ = VK_NULL_HANDLE;
+    VkDevice device_ = VK_NULL_HANDLE;
+    uint32_t queue_family_ = 0;
+    VkQueue queue_ = VK_NULL_HANDLE;
+    VkImage image_ = VK_NULL_HANDLE;
+    VkDeviceMemory memory_ = VK_NULL_HANDLE;
+    VkImageView view_ = VK_NULL_HANDLE;
+    VkRenderPass render_pass_ = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer_ = VK_NULL_HANDLE;
+    BenchFrame frames_[kFramesInFlight];
+    uint32_t frame_index_ = 0;
+};
+
+} // namespace bench
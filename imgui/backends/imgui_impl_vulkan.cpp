@@ -28,6 +28,15 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: Vulkan: Added ImGui_ImplVulkan_InitInfo::UseFrameHash: draw data identical to the previous frame of its viewport reuses the uploaded buffers. Added ImGui_ImplVulkan_IsFrameUnchanged(), ImGui_ImplVulkan_GetFrameHashStats().
+//  2026-10-17: Vulkan: Added ImGui_ImplVulkan_InitInfo::ParallelForFn: secondary viewports are recorded into secondary command buffers on worker threads and submitted together.
+//  2026-10-17: Vulkan: Buffers and textures are sub-allocated from shared device memory blocks with a buddy allocator instead of one vkAllocateMemory() each. Added ImGui_ImplVulkan_GetMemoryStats(), ImGui_ImplVulkan_CompactMemory().
+//  2026-10-17: Vulkan: Secondary viewport pipelines are created with ImGui_ImplVulkan_InitInfo::PipelineCache as well.
+//  2026-10-17: Vulkan: Adjacent draw commands sharing texture and scissor are merged across draw lists before recording. Added ImGui_ImplVulkan_InitInfo::UseMultiDrawIndirect to submit them with vkCmdDrawIndexedIndirect(). Added ImGui_ImplVulkan_GetRenderStats().
+//  2026-10-17: Vulkan: Added ImGui_ImplVulkan_InitInfo::UseDescriptorIndexing: textures are sampled from one descriptor array indexed by a push constant, without rebinding descriptor sets between draws. Define IMGUI_IMPL_VULKAN_BINDLESS_FRAG_U32 to compile its shader in from glslangValidator output.
+//  2026-10-17: Vulkan: Texture updates upload each of tex->Updates[] as its own region unless the bounding box is cheaper. Added ImGui_ImplVulkan_GetUploadStats().
+//  2026-10-17: Vulkan: Texture uploads go through a ring of persistently mapped staging buffers retired by fences. Removed vkQueueWaitIdle() from ImGui_ImplVulkan_UpdateTexture().
+//  2026-10-17: Vulkan: Vertices and indices share one persistently mapped buffer per frame in flight (host-coherent when available), grown geometrically and shrunk with hysteresis.
 //  2026-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2025-09-26: [Helpers] *BREAKING CHANGE*: Vulkan: Helper ImGui_ImplVulkanH_DestroyWindow() does not call vkDestroySurfaceKHR(): as surface is created by caller of ImGui_ImplVulkanH_CreateOrResizeWindow(), it is more consistent that we don't destroy it. (#9163)
 //  2026-01-05: [Helpers] *BREAKING CHANGE*: Vulkan: Helper for creating render pass uses ImGui_ImplVulkanH_Window::AttachmentDesc to create render pass. Removed ClearEnabled. (#9152)
@@ -113,6 +122,9 @@
 #ifndef IM_MAX
 #define IM_MAX(A, B)    (((A) >= (B)) ? (A) : (B))
 #endif
+#ifndef IM_MIN
+#define IM_MIN(A, B)    (((A) < (B)) ? (A) : (B))
+#endif
 #undef Status // X11 headers are leaking this.
 
 // Visual Studio warnings
@@ -157,7 +169,9 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindVertexBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdCopyBufferToImage) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexed) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexedIndirect) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdEndRenderPass) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdExecuteCommands) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPipelineBarrier) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPushConstants) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdSetScissor) \
@@ -202,6 +216,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkFreeMemory) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetBufferMemoryRequirements) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetDeviceQueue) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetFenceStatus) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetImageMemoryRequirements) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceProperties) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceMemoryProperties) \
@@ -232,16 +247,110 @@ static PFN_vkCmdBeginRenderingKHR   ImGuiImplVulkanFuncs_vkCmdBeginRenderingKHR;
 static PFN_vkCmdEndRenderingKHR     ImGuiImplVulkanFuncs_vkCmdEndRenderingKHR;
 #endif
 
-// Reusable buffers used for rendering 1 current in-flight frame, for ImGui_ImplVulkan_RenderDrawData()
+// Device memory is sub-allocated from blocks of IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE bytes (must be a power of two) with a binary buddy allocator.
+// Requests larger than half a block get a dedicated VkDeviceMemory.
+#ifndef IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE
+#define IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE     (16 * 1024 * 1024)
+#endif
+// Smallest buddy node. Also keeps node offsets aligned to nonCoherentAtomSize, which the spec caps at 256.
+#define IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE  (256)
+#define IMGUI_IMPL_VULKAN_MEMORY_MAX_ORDERS     (32)
+
+struct ImGui_ImplVulkan_MemoryBlock;
+
+// Memory handed out by ImGui_ImplVulkan_AllocateMemory(): a buddy node inside a shared block, or a dedicated VkDeviceMemory.
+// [Please zero-clear before use!]
+struct ImGui_ImplVulkan_MemoryAllocation
+{
+    VkDeviceMemory      Memory;
+    VkDeviceSize        Offset;
+    VkDeviceSize        Size;                   // Node size (a power of two) inside a block, allocation size when dedicated
+    VkDeviceSize        RequestedSize;
+    void*               MappedData;             // Host pointer to Offset, for host-visible memory types
+    bool                IsCoherent;
+    ImGui_ImplVulkan_MemoryBlock* Block;        // nullptr when dedicated
+};
+
+// One VkDeviceMemory of IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE bytes. Host-visible blocks stay mapped as a whole.
+// FreeNodes[order] holds the offsets of free nodes of (IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << order) bytes.
+struct ImGui_ImplVulkan_MemoryBlock
+{
+    VkDeviceMemory      Memory;
+    void*               MappedData;
+    int                 PoolIndex;
+    int                 AllocationCount;
+    VkDeviceSize        UsedBytes;              // Sum of node sizes handed out
+    VkDeviceSize        RequestedBytes;         // Sum of sizes asked for
+    ImVector<VkDeviceSize> FreeNodes[IMGUI_IMPL_VULKAN_MEMORY_MAX_ORDERS];
+
+    ImGui_ImplVulkan_MemoryBlock() { memset((void*)this, 0, sizeof(*this)); }
+};
+
+// Blocks sharing a memory type. Buffers and images never share a pool, so bufferImageGranularity doesn't apply.
+struct ImGui_ImplVulkan_MemoryPool
+{
+    uint32_t            MemoryTypeIndex;
+    bool                ForImages;
+    ImVector<ImGui_ImplVulkan_MemoryBlock*> Blocks;
+};
+
+// Reusable buffer used for rendering 1 current in-flight frame, for ImGui_ImplVulkan_RenderDrawData()
+// Vertices are stored at offset 0 and indices at IndexOffset. The memory stays mapped for the lifetime of the buffer.
 // [Please zero-clear before use!]
 struct ImGui_ImplVulkan_FrameRenderBuffers
 {
-    VkDeviceMemory      VertexBufferMemory;
-    VkDeviceMemory      IndexBufferMemory;
-    VkDeviceSize        VertexBufferSize;
-    VkDeviceSize        IndexBufferSize;
-    VkBuffer            VertexBuffer;
-    VkBuffer            IndexBuffer;
+    ImGui_ImplVulkan_MemoryAllocation Memory;
+    VkDeviceSize        BufferSize;
+    VkBuffer            Buffer;
+    VkDeviceSize        IndexOffset;
+    VkDeviceSize        IndirectOffset;         // VkDrawIndexedIndirectCommand[], with UseMultiDrawIndirect
+    int                 UnderusedFrames;        // Consecutive frames which used less than 1/4 of BufferSize
+};
+
+// Frame buffers grow geometrically and only shrink after being mostly unused for this many frames in a row,
+// so a large table scrolling in and out of view doesn't reallocate every few frames.
+#define IMGUI_IMPL_VULKAN_BUFFER_SHRINK_FRAMES  (300)
+
+// Staging memory and command buffer for texture uploads, used round-robin. A slot is retired through its fence,
+// so the CPU only blocks when it laps an upload the GPU hasn't finished yet.
+// [Please zero-clear before use!]
+struct ImGui_ImplVulkan_UploadSlot
+{
+    VkCommandPool       CommandPool;
+    VkCommandBuffer     CommandBuffer;
+    VkFence             Fence;
+    ImGui_ImplVulkan_MemoryAllocation Memory;
+    VkDeviceSize        BufferSize;
+    VkBuffer            Buffer;
+    VkDeviceSize        Used;                   // Bytes written by the batch being recorded
+    bool                Recording;              // CommandBuffer is between vkBeginCommandBuffer() and submission
+    bool                Pending;                // Submitted, Fence not yet waited on
+};
+
+#ifndef IMGUI_IMPL_VULKAN_UPLOAD_SLOTS
+#define IMGUI_IMPL_VULKAN_UPLOAD_SLOTS          (4)
+#endif
+// Staging buffers grown past this size (e.g. by a full atlas upload) are released when their slot is reused.
+#define IMGUI_IMPL_VULKAN_UPLOAD_KEEP_SIZE      (4 * 1024 * 1024)
+// Estimated fixed cost of one extra VkBufferImageCopy region, in bytes, when choosing between tex->Updates[] and tex->UpdateRect.
+#define IMGUI_IMPL_VULKAN_UPLOAD_REGION_COST    (4 * 1024)
+
+// Position of a texture in the descriptor array used with UseDescriptorIndexing, keyed by the ImTextureID returned by ImGui_ImplVulkan_AddTexture()
+struct ImGui_ImplVulkan_BindlessEntry
+{
+    ImTextureID         TexID;
+    uint32_t            Index;
+};
+
+// Run of merged draws sharing scissor and texture, or a user callback, built by ImGui_ImplVulkan_BuildDrawBatches()
+struct ImGui_ImplVulkan_DrawBatch
+{
+    const ImDrawList*   CallbackList;           // Non-null: call CallbackCmd->UserCallback instead of drawing
+    const ImDrawCmd*    CallbackCmd;
+    VkRect2D            Scissor;
+    ImTextureID         TexID;
+    uint32_t            FirstDraw;              // Index into ImGui_ImplVulkan_WindowRenderBuffers::Draws
+    uint32_t            DrawCount;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -251,11 +360,20 @@ struct ImGui_ImplVulkan_WindowRenderBuffers
     uint32_t            Index;
     uint32_t            Count;
     ImVector<ImGui_ImplVulkan_FrameRenderBuffers> FrameRenderBuffers;
+    ImVector<VkDrawIndexedIndirectCommand> Draws;   // Scratch: merged draws of the current frame
+    ImVector<ImGui_ImplVulkan_DrawBatch> Batches;   // Scratch: batches of the current frame
+    bool                HasCallbacks;               // Batches contain user callbacks
+    bool                Reused;                     // UseFrameHash: FrameRenderBuffers[Index], Draws and Batches are kept from the previous frame
+    ImU64               FrameHash;                  // UseFrameHash: hash of the draw data uploaded to FrameRenderBuffers[Index], 0 if none
+    ImU64               PendingHash;                // UseFrameHash: hash of HashDrawData, computed once per frame
+    const ImDrawData*   HashDrawData;
+    int                 HashFrame;
+    bool                HashMatch;
 };
 
 struct ImGui_ImplVulkan_Texture
 {
-    VkDeviceMemory              Memory;
+    ImGui_ImplVulkan_MemoryAllocation Memory;
     VkImage                     Image;
     VkImageView                 ImageView;
     VkDescriptorSet             DescriptorSet;
@@ -272,8 +390,11 @@ struct ImGui_ImplVulkan_ViewportData
     bool                                    WindowOwned;
     bool                                    SwapChainNeedRebuild;   // Flag when viewport swapchain resized in the middle of processing a frame
     bool                                    SwapChainSuboptimal;    // Flag when VK_SUBOPTIMAL_KHR was returned.
+    bool                                    SecondaryRecorded;      // With ParallelForFn: the frame's secondary command buffer holds this frame's draws
+    bool                                    SecondaryDeferred;      // With ParallelForFn: record it in ImGui_ImplVulkan_SubmitViewports()
+    ImGui_ImplVulkan_RenderStats            SecondaryStats;
 
-    ImGui_ImplVulkan_ViewportData() { WindowOwned = SwapChainNeedRebuild = SwapChainSuboptimal = false; memset((void*)&RenderBuffers, 0, sizeof(RenderBuffers)); }
+    ImGui_ImplVulkan_ViewportData() { WindowOwned = SwapChainNeedRebuild = SwapChainSuboptimal = SecondaryRecorded = SecondaryDeferred = false; memset((void*)&RenderBuffers, 0, sizeof(RenderBuffers)); memset((void*)&SecondaryStats, 0, sizeof(SecondaryStats)); }
     ~ImGui_ImplVulkan_ViewportData() { }
 };
 
@@ -281,8 +402,10 @@ struct ImGui_ImplVulkan_ViewportData
 struct ImGui_ImplVulkan_Data
 {
     ImGui_ImplVulkan_InitInfo   VulkanInitInfo;
+    VkPhysicalDeviceMemoryProperties MemoryProperties;
     VkDeviceSize                BufferMemoryAlignment;
     VkDeviceSize                NonCoherentAtomSize;
+    uint32_t                    MaxDrawIndirectCount;
     VkPipelineCreateFlags       PipelineCreateFlags;
     VkDescriptorSetLayout       DescriptorSetLayout;
     VkPipelineLayout            PipelineLayout;
@@ -293,19 +416,43 @@ struct ImGui_ImplVulkan_Data
     VkDescriptorPool            DescriptorPool;
     ImVector<VkFormat>          PipelineRenderingCreateInfoColorAttachmentFormats; // Deep copy of format array
 
+    // Device memory
+    ImVector<ImGui_ImplVulkan_MemoryPool> MemoryPools;
+    int                         MemoryDedicatedCount;
+    VkDeviceSize                MemoryDedicatedBytes;
+
     // Texture management
     VkSampler                   TexSamplerLinear;
-    VkCommandPool               TexCommandPool;
-    VkCommandBuffer             TexCommandBuffer;
+    ImGui_ImplVulkan_UploadSlot UploadSlots[IMGUI_IMPL_VULKAN_UPLOAD_SLOTS];
+    int                         UploadSlotIndex;
+    bool                        UploadDeferSubmit;      // Set while RenderDrawData() processes textures, so all updates share one submit
+    ImVector<VkBufferImageCopy> UploadRegions;          // Scratch for ImGui_ImplVulkan_UpdateTexture()
+    ImGui_ImplVulkan_UploadStats UploadStats;
+    ImGui_ImplVulkan_RenderStats RenderStats;
+    ImGui_ImplVulkan_FrameHashStats FrameHashStats;
+
+    // Descriptor indexing (UseDescriptorIndexing)
+    VkDescriptorSetLayout       BindlessSetLayout;
+    VkDescriptorPool            BindlessPool;
+    VkDescriptorSet             BindlessSet;            // IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES combined image samplers
+    ImVector<ImGui_ImplVulkan_BindlessEntry> BindlessEntries; // Sorted by TexID
+    ImVector<uint32_t>          BindlessFreeIndices;
+    uint32_t                    BindlessNextIndex;
 
     // Render buffers for main window
     ImGui_ImplVulkan_WindowRenderBuffers MainWindowRenderBuffers;
 
+    // Secondary viewports waiting for ImGui_ImplVulkan_SubmitViewports() (ParallelForFn)
+    ImVector<ImGuiViewport*>    PendingViewports;
+    ImVector<ImGuiViewport*>    RecordViewports;        // Scratch: viewports recorded through ParallelForFn
+    ImVector<VkSubmitInfo>      PendingSubmitInfos;     // Scratch
+
     ImGui_ImplVulkan_Data()
     {
         memset((void*)this, 0, sizeof(*this));
         BufferMemoryAlignment = 256;
         NonCoherentAtomSize = 64;
+        MaxDrawIndirectCount = 1;
     }
 };
 
@@ -316,6 +463,9 @@ struct ImGui_ImplVulkan_Data
 // Forward Declarations
 static void ImGui_ImplVulkan_InitMultiViewportSupport();
 static void ImGui_ImplVulkan_ShutdownMultiViewportSupport();
+static void ImGui_ImplVulkan_EndViewportCommands(ImGuiViewport* viewport);
+static void ImGui_ImplVulkan_RecordViewport(ImGuiViewport* viewport);
+static void ImGui_ImplVulkan_SubmitViewports();
 
 // backends/vulkan/glsl_shader.vert, compiled with:
 // # glslangValidator -V -x -o glsl_shader.vert.u32 glsl_shader.vert
@@ -422,6 +572,69 @@ static uint32_t __glsl_shader_frag_spv[] =
     0x00010038
 };
 
+// backends/vulkan/glsl_shader_bindless.frag, used with UseDescriptorIndexing (SPIR-V 1.0, no extension required).
+// Regenerate with backends/vulkan/generate_spv.sh, which also runs spirv-val:
+// # glslangValidator -V -x -o glsl_shader_bindless.frag.u32 glsl_shader_bindless.frag
+// Define IMGUI_IMPL_VULKAN_BINDLESS_FRAG_U32 to the path of such a .u32 file to compile it in instead of the words below
+// (the SMLUI build does this whenever glslangValidator is found).
+// FIXME: the embedded words were assembled by hand and have not been regenerated with glslangValidator nor checked with spirv-val yet.
+/*
+#version 450 core
+layout(constant_id = 0) const uint kMaxTextures = 1024; // Set to IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES at pipeline creation
+layout(location = 0) out vec4 fColor;
+layout(set=0, binding=0) uniform sampler2D sTextures[kMaxTextures];
+layout(push_constant) uniform uPushConstant { layout(offset = 16) uint uTextureIndex; } pc;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+void main()
+{
+    fColor = In.Color * texture(sTextures[pc.uTextureIndex], In.UV.st);
+}
+*/
+#ifdef IMGUI_IMPL_VULKAN_BINDLESS_FRAG_U32
+static uint32_t __glsl_shader_bindless_frag_spv[] =
+{
+#include IMGUI_IMPL_VULKAN_BINDLESS_FRAG_U32
+};
+#else
+static uint32_t __glsl_shader_bindless_frag_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x0000002a,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x0007000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000009,0x0000000d,0x00030010,
+    0x00000004,0x00000007,0x00030003,0x00000002,0x000001c2,0x00040005,0x00000004,0x6e69616d,
+    0x00000000,0x00040005,0x00000009,0x6c6f4366,0x0000726f,0x00030005,0x0000000b,0x00000000,
+    0x00050006,0x0000000b,0x00000000,0x6f6c6f43,0x00000072,0x00040006,0x0000000b,0x00000001,
+    0x00005655,0x00030005,0x0000000d,0x00006e49,0x00060005,0x0000001e,0x78614d6b,0x74786554,
+    0x73657275,0x00000000,0x00050005,0x00000016,0x78655473,0x65727574,0x00000073,0x00060005,
+    0x00000020,0x73755075,0x6e6f4368,0x6e617473,0x00000074,0x00070006,0x00000020,0x00000000,
+    0x78655475,0x65727574,0x65646e49,0x00000078,0x00030005,0x00000024,0x00006370,0x00040047,
+    0x00000009,0x0000001e,0x00000000,0x00040047,0x0000000d,0x0000001e,0x00000000,0x00040047,
+    0x0000001e,0x00000001,0x00000000,0x00040047,0x00000016,0x00000022,0x00000000,0x00040047,
+    0x00000016,0x00000021,0x00000000,0x00050048,0x00000020,0x00000000,0x00000023,0x00000010,
+    0x00030047,0x00000020,0x00000002,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,
+    0x00030016,0x00000006,0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040020,
+    0x00000008,0x00000003,0x00000007,0x0004003b,0x00000008,0x00000009,0x00000003,0x00040017,
+    0x0000000a,0x00000006,0x00000002,0x0004001e,0x0000000b,0x00000007,0x0000000a,0x00040020,
+    0x0000000c,0x00000001,0x0000000b,0x0004003b,0x0000000c,0x0000000d,0x00000001,0x00040015,
+    0x0000000e,0x00000020,0x00000001,0x0004002b,0x0000000e,0x0000000f,0x00000000,0x00040020,
+    0x00000010,0x00000001,0x00000007,0x00090019,0x00000013,0x00000006,0x00000001,0x00000000,
+    0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,0x00000014,0x00000013,0x00040015,
+    0x0000001f,0x00000020,0x00000000,0x00040032,0x0000001f,0x0000001e,0x00000400,0x0004001c,
+    0x00000021,0x00000014,0x0000001e,0x00040020,0x00000022,0x00000000,0x00000021,0x0004003b,
+    0x00000022,0x00000016,0x00000000,0x0003001e,0x00000020,0x0000001f,0x00040020,0x00000023,
+    0x00000009,0x00000020,0x0004003b,0x00000023,0x00000024,0x00000009,0x00040020,0x00000025,
+    0x00000009,0x0000001f,0x00040020,0x00000026,0x00000000,0x00000014,0x0004002b,0x0000000e,
+    0x00000018,0x00000001,0x00040020,0x00000019,0x00000001,0x0000000a,0x00050036,0x00000002,
+    0x00000004,0x00000000,0x00000003,0x000200f8,0x00000005,0x00050041,0x00000010,0x00000011,
+    0x0000000d,0x0000000f,0x0004003d,0x00000007,0x00000012,0x00000011,0x00050041,0x00000025,
+    0x00000027,0x00000024,0x0000000f,0x0004003d,0x0000001f,0x00000028,0x00000027,0x00050041,
+    0x00000026,0x00000029,0x00000016,0x00000028,0x0004003d,0x00000014,0x00000017,0x00000029,
+    0x00050041,0x00000019,0x0000001a,0x0000000d,0x00000018,0x0004003d,0x0000000a,0x0000001b,
+    0x0000001a,0x00050057,0x00000007,0x0000001c,0x00000017,0x0000001b,0x00050085,0x00000007,
+    0x0000001d,0x00000012,0x0000001c,0x0003003e,0x00000009,0x0000001d,0x000100fd,0x00010038
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // FUNCTIONS
 //-----------------------------------------------------------------------------
@@ -437,9 +650,7 @@ static ImGui_ImplVulkan_Data* ImGui_ImplVulkan_GetBackendData()
 static uint32_t ImGui_ImplVulkan_MemoryType(VkMemoryPropertyFlags properties, uint32_t type_bits)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
-    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
-    VkPhysicalDeviceMemoryProperties prop;
-    vkGetPhysicalDeviceMemoryProperties(v->PhysicalDevice, &prop);
+    const VkPhysicalDeviceMemoryProperties& prop = bd->MemoryProperties;
     for (uint32_t i = 0; i < prop.memoryTypeCount; i++)
         if ((prop.memoryTypes[i].propertyFlags & properties) == properties && type_bits & (1 << i))
             return i;
@@ -462,38 +673,336 @@ static inline VkDeviceSize AlignBufferSize(VkDeviceSize size, VkDeviceSize align
     return (size + alignment - 1) & ~(alignment - 1);
 }
 
-static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory, VkDeviceSize& buffer_size, VkDeviceSize new_size, VkBufferUsageFlagBits usage)
+//-----------------------------------------------------------------------------
+// Device memory: binary buddy allocator over shared blocks
+//-----------------------------------------------------------------------------
+
+static int ImGui_ImplVulkan_MemoryTopOrder()
+{
+    int order = 0;
+    while (((VkDeviceSize)IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << order) < (VkDeviceSize)IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE)
+        order++;
+    return order;
+}
+
+static ImGui_ImplVulkan_MemoryBlock* ImGui_ImplVulkan_CreateMemoryBlock(int pool_index)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkan_MemoryPool* pool = &bd->MemoryPools[pool_index];
+    ImGui_ImplVulkan_MemoryBlock* block = IM_NEW(ImGui_ImplVulkan_MemoryBlock)();
+    block->PoolIndex = pool_index;
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE;
+    alloc_info.memoryTypeIndex = pool->MemoryTypeIndex;
+    VkResult err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &block->Memory);
+    check_vk_result(err);
+    if (bd->MemoryProperties.memoryTypes[pool->MemoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        err = vkMapMemory(v->Device, block->Memory, 0, VK_WHOLE_SIZE, 0, &block->MappedData);
+        check_vk_result(err);
+    }
+    block->FreeNodes[ImGui_ImplVulkan_MemoryTopOrder()].push_back(0);
+    pool->Blocks.push_back(block);
+    return block;
+}
+
+static void ImGui_ImplVulkan_DestroyMemoryBlock(ImGui_ImplVulkan_MemoryBlock* block)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (block->MappedData)
+        vkUnmapMemory(v->Device, block->Memory);
+    vkFreeMemory(v->Device, block->Memory, v->Allocator);
+    for (int order = 0; order < IMGUI_IMPL_VULKAN_MEMORY_MAX_ORDERS; order++)
+        block->FreeNodes[order].clear();
+    bd->MemoryPools[block->PoolIndex].Blocks.find_erase(block);
+    IM_DELETE(block);
+}
+
+// Allocate memory of the given type for a buffer or an image. The result is bound with vkBind*Memory(..., out->Memory, out->Offset).
+static void ImGui_ImplVulkan_AllocateMemory(const VkMemoryRequirements& req, uint32_t memory_type_index, bool for_image, ImGui_ImplVulkan_MemoryAllocation* out)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    IM_ASSERT(memory_type_index < bd->MemoryProperties.memoryTypeCount);
+    VkMemoryPropertyFlags flags = bd->MemoryProperties.memoryTypes[memory_type_index].propertyFlags;
+    memset((void*)out, 0, sizeof(*out));
+    out->RequestedSize = req.size;
+    out->IsCoherent = (flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+    // Buddy nodes are aligned to their own size, so a node at least as large as the alignment satisfies it
+    VkDeviceSize node_size = IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE;
+    int order = 0;
+    while (node_size < req.size || node_size < req.alignment)
+    {
+        node_size <<= 1;
+        order++;
+    }
+    if (node_size > IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE / 2)
+    {
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize = IM_MAX(v->MinAllocationSize, req.size);
+        alloc_info.memoryTypeIndex = memory_type_index;
+        VkResult err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &out->Memory);
+        check_vk_result(err);
+        if (flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+        {
+            err = vkMapMemory(v->Device, out->Memory, 0, VK_WHOLE_SIZE, 0, &out->MappedData);
+            check_vk_result(err);
+        }
+        out->Size = alloc_info.allocationSize;
+        bd->MemoryDedicatedCount++;
+        bd->MemoryDedicatedBytes += out->Size;
+        return;
+    }
+
+    int pool_index = 0;
+    while (pool_index < bd->MemoryPools.Size && (bd->MemoryPools[pool_index].MemoryTypeIndex != memory_type_index || bd->MemoryPools[pool_index].ForImages != for_image))
+        pool_index++;
+    if (pool_index == bd->MemoryPools.Size)
+    {
+        ImGui_ImplVulkan_MemoryPool pool;
+        pool.MemoryTypeIndex = memory_type_index;
+        pool.ForImages = for_image;
+        bd->MemoryPools.push_back(pool);
+    }
+
+    // Best fit: take the smallest free node that is large enough, in any block
+    const int top_order = ImGui_ImplVulkan_MemoryTopOrder();
+    ImGui_ImplVulkan_MemoryBlock* block = nullptr;
+    int found_order = top_order + 1;
+    for (ImGui_ImplVulkan_MemoryBlock* candidate : bd->MemoryPools[pool_index].Blocks)
+        for (int o = order; o < found_order; o++)
+            if (candidate->FreeNodes[o].Size > 0)
+            {
+                block = candidate;
+                found_order = o;
+                break;
+            }
+    if (block == nullptr)
+    {
+        block = ImGui_ImplVulkan_CreateMemoryBlock(pool_index);
+        found_order = top_order;
+    }
+
+    // Split the node down to the requested order, returning upper halves to the free lists
+    VkDeviceSize offset = block->FreeNodes[found_order].back();
+    block->FreeNodes[found_order].pop_back();
+    while (found_order > order)
+    {
+        found_order--;
+        block->FreeNodes[found_order].push_back(offset + ((VkDeviceSize)IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << found_order));
+    }
+    block->AllocationCount++;
+    block->UsedBytes += node_size;
+    block->RequestedBytes += req.size;
+    out->Memory = block->Memory;
+    out->Offset = offset;
+    out->Size = node_size;
+    out->MappedData = block->MappedData ? (void*)((char*)block->MappedData + offset) : nullptr;
+    out->Block = block;
+}
+
+static void ImGui_ImplVulkan_FreeMemory(ImGui_ImplVulkan_MemoryAllocation* alloc)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (alloc->Memory == VK_NULL_HANDLE)
+        return;
+    if (ImGui_ImplVulkan_MemoryBlock* block = alloc->Block)
+    {
+        // Merge with the buddy for as long as it is free too
+        const int top_order = ImGui_ImplVulkan_MemoryTopOrder();
+        VkDeviceSize offset = alloc->Offset;
+        int order = 0;
+        while (((VkDeviceSize)IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << order) < alloc->Size)
+            order++;
+        while (order < top_order && block->FreeNodes[order].find_erase_unsorted(offset ^ ((VkDeviceSize)IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << order)))
+        {
+            offset &= ~((VkDeviceSize)IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << order);
+            order++;
+        }
+        block->FreeNodes[order].push_back(offset);
+        block->AllocationCount--;
+        block->UsedBytes -= alloc->Size;
+        block->RequestedBytes -= alloc->RequestedSize;
+
+        // Keep the last block of a pool around, frame buffers come and go
+        if (block->AllocationCount == 0 && bd->MemoryPools[block->PoolIndex].Blocks.Size > 1)
+            ImGui_ImplVulkan_DestroyMemoryBlock(block);
+    }
+    else
+    {
+        if (alloc->MappedData)
+            vkUnmapMemory(v->Device, alloc->Memory);
+        vkFreeMemory(v->Device, alloc->Memory, v->Allocator);
+        bd->MemoryDedicatedCount--;
+        bd->MemoryDedicatedBytes -= alloc->Size;
+    }
+    memset((void*)alloc, 0, sizeof(*alloc));
+}
+
+// Create a host-visible buffer which stays mapped until destroyed. Prefer host-coherent memory so writes need no vkFlushMappedMemoryRanges() call.
+static VkDeviceSize CreateMappedBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer* buffer, ImGui_ImplVulkan_MemoryAllocation* memory)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     VkResult err;
-    if (buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(v->Device, buffer, v->Allocator);
-    if (buffer_memory != VK_NULL_HANDLE)
-        vkFreeMemory(v->Device, buffer_memory, v->Allocator);
 
-    VkDeviceSize buffer_size_aligned = AlignBufferSize(IM_MAX(v->MinAllocationSize, new_size), bd->BufferMemoryAlignment);
+    VkDeviceSize buffer_size_aligned = AlignBufferSize(size, bd->BufferMemoryAlignment);
     VkBufferCreateInfo buffer_info = {};
     buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     buffer_info.size = buffer_size_aligned;
     buffer_info.usage = usage;
     buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &buffer);
+    err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, buffer);
     check_vk_result(err);
 
     VkMemoryRequirements req;
-    vkGetBufferMemoryRequirements(v->Device, buffer, &req);
+    vkGetBufferMemoryRequirements(v->Device, *buffer, &req);
     bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
-    VkMemoryAllocateInfo alloc_info = {};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.allocationSize = req.size;
-    alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
-    err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &buffer_memory);
+    uint32_t memory_type_index = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, req.memoryTypeBits);
+    if (memory_type_index == 0xFFFFFFFF)
+        memory_type_index = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+    ImGui_ImplVulkan_AllocateMemory(req, memory_type_index, false, memory);
+
+    err = vkBindBufferMemory(v->Device, *buffer, memory->Memory, memory->Offset);
     check_vk_result(err);
+    return buffer_size_aligned;
+}
 
-    err = vkBindBufferMemory(v->Device, buffer, buffer_memory, 0);
+// Flush the first 'size' bytes of a mapped allocation. Offsets of sub-allocations are multiples of nonCoherentAtomSize,
+// so rounding the size up stays within the node; dedicated memory is flushed to its end once the rounded size reaches it.
+static void FlushMappedBuffer(const ImGui_ImplVulkan_MemoryAllocation* memory, VkDeviceSize size)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkDeviceSize flush_size = AlignBufferSize(size, bd->NonCoherentAtomSize);
+    VkMappedMemoryRange range[1] = {};
+    range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range[0].memory = memory->Memory;
+    range[0].offset = memory->Offset;
+    range[0].size = (flush_size < memory->Size) ? flush_size : (memory->Block != nullptr) ? memory->Size : VK_WHOLE_SIZE;
+    VkResult err = vkFlushMappedMemoryRanges(v->Device, 1, range);
     check_vk_result(err);
-    buffer_size = buffer_size_aligned;
+}
+
+static void CreateOrResizeFrameRenderBuffer(ImGui_ImplVulkan_FrameRenderBuffers* rb, VkDeviceSize new_size)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkan_DestroyFrameRenderBuffers(v->Device, rb, v->Allocator);
+    rb->BufferSize = CreateMappedBuffer(new_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, &rb->Buffer, &rb->Memory);
+    rb->UnderusedFrames = 0;
+}
+
+static void DestroyUploadSlotBuffer(ImGui_ImplVulkan_UploadSlot* slot)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (slot->Buffer) { vkDestroyBuffer(v->Device, slot->Buffer, v->Allocator); slot->Buffer = VK_NULL_HANDLE; }
+    ImGui_ImplVulkan_FreeMemory(&slot->Memory);
+    slot->BufferSize = 0;
+}
+
+// Submit the batch being recorded, if any. The slot's fence retires it.
+static void ImGui_ImplVulkan_SubmitUploads()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    ImGui_ImplVulkan_UploadSlot* slot = &bd->UploadSlots[bd->UploadSlotIndex];
+    if (!slot->Recording)
+        return;
+    if (!slot->Memory.IsCoherent)
+        FlushMappedBuffer(&slot->Memory, slot->Used);
+    VkResult err = vkEndCommandBuffer(slot->CommandBuffer);
+    check_vk_result(err);
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &slot->CommandBuffer;
+    err = vkQueueSubmit(v->Queue, 1, &submit_info, slot->Fence);
+    check_vk_result(err);
+    slot->Recording = false;
+    slot->Pending = true;
+}
+
+// Reserve 'size' bytes of staging memory in the batch being recorded, opening a batch on the next slot if needed.
+// Returns the slot and writes the offset of the reservation. Copies recorded in the slot's command buffer are
+// submitted on v->Queue ahead of the frame which samples the texture, so queue submission order covers visibility.
+static ImGui_ImplVulkan_UploadSlot* ImGui_ImplVulkan_ReserveUpload(VkDeviceSize size, VkDeviceSize* out_offset)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkResult err;
+    ImGui_ImplVulkan_UploadSlot* slot = &bd->UploadSlots[bd->UploadSlotIndex];
+    VkDeviceSize offset = AlignBufferSize(slot->Used, IM_MAX(bd->NonCoherentAtomSize, (VkDeviceSize)16)); // bufferOffset must be a multiple of the texel size
+    if (slot->Recording && offset + size <= slot->BufferSize)
+    {
+        slot->Used = offset + size;
+        *out_offset = offset;
+        return slot;
+    }
+
+    // The current staging buffer is referenced by recorded copies and can't grow: submit it and move on.
+    ImGui_ImplVulkan_SubmitUploads();
+    bd->UploadSlotIndex = (bd->UploadSlotIndex + 1) % IMGUI_IMPL_VULKAN_UPLOAD_SLOTS;
+    slot = &bd->UploadSlots[bd->UploadSlotIndex];
+    if (slot->Pending)
+    {
+        if (vkGetFenceStatus(v->Device, slot->Fence) != VK_SUCCESS)
+            bd->UploadStats.TotalSlotWaits++;
+        err = vkWaitForFences(v->Device, 1, &slot->Fence, VK_TRUE, UINT64_MAX);
+        check_vk_result(err);
+        err = vkResetFences(v->Device, 1, &slot->Fence);
+        check_vk_result(err);
+        slot->Pending = false;
+    }
+    if (slot->BufferSize < size || slot->BufferSize > IMGUI_IMPL_VULKAN_UPLOAD_KEEP_SIZE)
+    {
+        DestroyUploadSlotBuffer(slot);
+        slot->BufferSize = CreateMappedBuffer(IM_MAX(size, (VkDeviceSize)256 * 1024), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, &slot->Buffer, &slot->Memory);
+    }
+
+    err = vkResetCommandPool(v->Device, slot->CommandPool, 0);
+    check_vk_result(err);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    err = vkBeginCommandBuffer(slot->CommandBuffer, &begin_info);
+    check_vk_result(err);
+    slot->Recording = true;
+    slot->Used = size;
+    *out_offset = 0;
+    return slot;
+}
+
+// Descriptor indexing: BindlessEntries is kept sorted by TexID, lookups are a binary search.
+static int ImGui_ImplVulkan_BindlessLowerBound(ImTextureID tex_id)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    int lo = 0, hi = bd->BindlessEntries.Size;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (bd->BindlessEntries[mid].TexID < tex_id)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static uint32_t ImGui_ImplVulkan_BindlessIndex(ImTextureID tex_id)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    int n = ImGui_ImplVulkan_BindlessLowerBound(tex_id);
+    IM_ASSERT(n < bd->BindlessEntries.Size && bd->BindlessEntries[n].TexID == tex_id && "With UseDescriptorIndexing, textures must be registered with ImGui_ImplVulkan_AddTexture()");
+    return (n < bd->BindlessEntries.Size && bd->BindlessEntries[n].TexID == tex_id) ? bd->BindlessEntries[n].Index : 0;
 }
 
 static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int fb_width, int fb_height)
@@ -508,10 +1017,10 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     // Bind Vertex And Index Buffer:
     if (draw_data->TotalVtxCount > 0)
     {
-        VkBuffer vertex_buffers[1] = { rb->VertexBuffer };
+        VkBuffer vertex_buffers[1] = { rb->Buffer };
         VkDeviceSize vertex_offset[1] = { 0 };
         vkCmdBindVertexBuffers(command_buffer, 0, 1, vertex_buffers, vertex_offset);
-        vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(command_buffer, rb->Buffer, rb->IndexOffset, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
     }
 
     // Setup viewport:
@@ -526,6 +1035,10 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         vkCmdSetViewport(command_buffer, 0, 1, &viewport);
     }
 
+    // Bind the texture array once, draws only push the texture index
+    if (bd->BindlessSet != VK_NULL_HANDLE)
+        vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &bd->BindlessSet, 0, nullptr);
+
     // Setup scale and translation:
     // Our visible imgui space lies from draw_data->DisplayPps (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
     {
@@ -540,26 +1053,219 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     }
 }
 
-// Render function
-void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline)
+// Walk all draw lists once, project and clamp clip rectangles, drop empty ones and merge adjacent commands.
+// Commands with the same scissor and texture form one batch. Inside a batch, a command whose indices directly follow
+// the previous draw with the same vertex offset extends that draw instead of adding one. Callbacks get their own batch.
+static void ImGui_ImplVulkan_BuildDrawBatches(ImDrawData* draw_data, ImGui_ImplVulkan_WindowRenderBuffers* wrb, int fb_width, int fb_height)
+{
+    wrb->Draws.resize(0);
+    wrb->Batches.resize(0);
+    wrb->HasCallbacks = false;
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    ImGui_ImplVulkan_DrawBatch* batch = nullptr;
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                ImGui_ImplVulkan_DrawBatch callback_batch = {};
+                callback_batch.CallbackList = draw_list;
+                callback_batch.CallbackCmd = pcmd;
+                wrb->Batches.push_back(callback_batch);
+                wrb->HasCallbacks = true;
+                batch = nullptr;
+                continue;
+            }
+            if (pcmd->ElemCount == 0)
+                continue;
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+
+            // Clamp to viewport as vkCmdSetScissor() won't accept values that are off bounds
+            if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+            if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+            if (clip_max.x > fb_width) { clip_max.x = (float)fb_width; }
+            if (clip_max.y > fb_height) { clip_max.y = (float)fb_height; }
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+
+            VkRect2D scissor;
+            scissor.offset.x = (int32_t)(clip_min.x);
+            scissor.offset.y = (int32_t)(clip_min.y);
+            scissor.extent.width = (uint32_t)(clip_max.x - clip_min.x);
+            scissor.extent.height = (uint32_t)(clip_max.y - clip_min.y);
+            ImTextureID tex_id = pcmd->GetTexID();
+            if (batch == nullptr || batch->TexID != tex_id || memcmp(&batch->Scissor, &scissor, sizeof(scissor)) != 0)
+            {
+                ImGui_ImplVulkan_DrawBatch new_batch = {};
+                new_batch.Scissor = scissor;
+                new_batch.TexID = tex_id;
+                new_batch.FirstDraw = (uint32_t)wrb->Draws.Size;
+                wrb->Batches.push_back(new_batch);
+                batch = &wrb->Batches.back();
+            }
+
+            VkDrawIndexedIndirectCommand draw;
+            draw.indexCount = pcmd->ElemCount;
+            draw.instanceCount = 1;
+            draw.firstIndex = pcmd->IdxOffset + global_idx_offset;
+            draw.vertexOffset = (int32_t)(pcmd->VtxOffset + global_vtx_offset);
+            draw.firstInstance = 0;
+            VkDrawIndexedIndirectCommand* last = batch->DrawCount > 0 ? &wrb->Draws.back() : nullptr;
+            if (last != nullptr && last->vertexOffset == draw.vertexOffset && last->firstIndex + last->indexCount == draw.firstIndex)
+            {
+                last->indexCount += draw.indexCount;
+            }
+            else
+            {
+                wrb->Draws.push_back(draw);
+                batch->DrawCount++;
+            }
+        }
+        global_idx_offset += draw_list->IdxBuffer.Size;
+        global_vtx_offset += draw_list->VtxBuffer.Size;
+    }
+}
+
+// 64-bit hash of a byte range, 8 bytes per step. Only used to compare a frame with the previous one, not for security.
+static ImU64 ImGui_ImplVulkan_HashBytes(const void* data, size_t size, ImU64 seed)
+{
+    const ImU64 k0 = 0x9E3779B97F4A7C15ULL;
+    const ImU64 k1 = 0xC2B2AE3D27D4EB4FULL;
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 h = seed ^ ((ImU64)size * k0);
+    for (; size >= 8; p += 8, size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, p, 8);
+        h ^= v * k1;
+        h = ((h << 31) | (h >> 33)) * k0;
+    }
+    ImU64 tail = 0;
+    memcpy(&tail, p, size);
+    h ^= tail * k1;
+    h ^= h >> 29;
+    h *= k0;
+    return h ^ (h >> 32);
+}
+
+// Hash everything the recorded commands depend on: framebuffer geometry, vertices, indices, and clip rectangle, texture and ranges
+// of each draw command. Returns 0 for draw data with user callbacks, which may draw differently with identical draw data.
+static ImU64 ImGui_ImplVulkan_HashDrawData(ImDrawData* draw_data, ImU64* hashed_bytes)
+{
+    struct CmdKey
+    {
+        ImVec4          ClipRect;
+        ImU64           TexID;
+        unsigned int    VtxOffset;
+        unsigned int    IdxOffset;
+        unsigned int    ElemCount;
+        unsigned int    Pad;
+    };
+    float geometry[6] = { draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplaySize.x, draw_data->DisplaySize.y, draw_data->FramebufferScale.x, draw_data->FramebufferScale.y };
+    ImU64 h = ImGui_ImplVulkan_HashBytes(geometry, sizeof(geometry), (ImU64)draw_data->CmdLists.Size);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        h = ImGui_ImplVulkan_HashBytes(draw_list->VtxBuffer.Data, draw_list->VtxBuffer.size_in_bytes(), h);
+        h = ImGui_ImplVulkan_HashBytes(draw_list->IdxBuffer.Data, draw_list->IdxBuffer.size_in_bytes(), h);
+        *hashed_bytes += (ImU64)(draw_list->VtxBuffer.size_in_bytes() + draw_list->IdxBuffer.size_in_bytes());
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            if (cmd.UserCallback != nullptr)
+                return 0;
+            CmdKey key;
+            key.ClipRect = cmd.ClipRect;
+            key.TexID = (ImU64)cmd.GetTexID();
+            key.VtxOffset = cmd.VtxOffset;
+            key.IdxOffset = cmd.IdxOffset;
+            key.ElemCount = cmd.ElemCount;
+            key.Pad = 0;
+            h = ImGui_ImplVulkan_HashBytes(&key, sizeof(key), h);
+        }
+        *hashed_bytes += (ImU64)draw_list->CmdBuffer.Size * sizeof(CmdKey);
+    }
+    return h != 0 ? h : 1;
+}
+
+// Hash draw_data once per frame and compare it with the draw data last uploaded for its viewport.
+static bool ImGui_ImplVulkan_MatchFrameHash(ImDrawData* draw_data)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_ViewportData* viewport_renderer_data = (ImGui_ImplVulkan_ViewportData*)draw_data->OwnerViewport->RendererUserData;
+    IM_ASSERT(viewport_renderer_data != nullptr);
+    ImGui_ImplVulkan_WindowRenderBuffers* wrb = &viewport_renderer_data->RenderBuffers;
+    const int frame_count = ImGui::GetFrameCount();
+    if (wrb->HashFrame != frame_count || wrb->HashDrawData != draw_data)
+    {
+        wrb->HashFrame = frame_count;
+        wrb->HashDrawData = draw_data;
+        wrb->PendingHash = ImGui_ImplVulkan_HashDrawData(draw_data, &bd->FrameHashStats.HashedBytes);
+        wrb->HashMatch = wrb->PendingHash != 0 && wrb->PendingHash == wrb->FrameHash && wrb->FrameRenderBuffers.Size > 0;
+        if (wrb->HashMatch)
+            bd->FrameHashStats.Hits++;
+        else
+            bd->FrameHashStats.Misses++;
+    }
+    return wrb->HashMatch;
+}
+
+bool ImGui_ImplVulkan_IsFrameUnchanged(ImDrawData* draw_data)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    if (!bd->VulkanInitInfo.UseFrameHash)
+        return false;
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return false;
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                return false;
+    return ImGui_ImplVulkan_MatchFrameHash(draw_data);
+}
+
+const ImGui_ImplVulkan_FrameHashStats* ImGui_ImplVulkan_GetFrameHashStats()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    return &bd->FrameHashStats;
+}
+
+// Render function, in two steps so secondary viewports can be recorded on other threads:
+// - ImGui_ImplVulkan_PrepareDrawData() updates textures, merges draws and sizes the frame buffer. It touches shared backend state.
+// - ImGui_ImplVulkan_RecordDrawData() copies vertices and records commands. It only touches the viewport's own buffers.
+static bool ImGui_ImplVulkan_PrepareDrawData(ImDrawData* draw_data)
 {
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
     int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
     int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
     if (fb_width <= 0 || fb_height <= 0)
-        return;
+        return false;
 
     // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
     // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    // All updates of the frame are recorded into one upload batch and submitted together.
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     if (draw_data->Textures != nullptr)
+    {
+        bd->UploadDeferSubmit = true;
         for (ImTextureData* tex : *draw_data->Textures)
             if (tex->Status != ImTextureStatus_OK)
                 ImGui_ImplVulkan_UpdateTexture(tex);
+        bd->UploadDeferSubmit = false;
+        ImGui_ImplVulkan_SubmitUploads();
+    }
 
-    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
-    if (pipeline == VK_NULL_HANDLE)
-        pipeline = bd->Pipeline;
 
     // Allocate array to store enough vertex/index buffers. Each unique viewport gets its own storage.
     ImGui_ImplVulkan_ViewportData* viewport_renderer_data = (ImGui_ImplVulkan_ViewportData*)draw_data->OwnerViewport->RendererUserData;
@@ -573,26 +1279,59 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         memset((void*)wrb->FrameRenderBuffers.Data, 0, wrb->FrameRenderBuffers.size_in_bytes());
     }
     IM_ASSERT(wrb->Count == v->ImageCount);
+
+    // Identical to the previous frame: draw from the buffer uploaded for it. Frames in flight only read it.
+    wrb->Reused = v->UseFrameHash && ImGui_ImplVulkan_MatchFrameHash(draw_data);
+    if (wrb->Reused)
+        return true;
+    if (v->UseFrameHash)
+        wrb->FrameHash = wrb->PendingHash;
+
     wrb->Index = (wrb->Index + 1) % wrb->Count;
     ImGui_ImplVulkan_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[wrb->Index];
 
+    // Merge draw commands ahead of recording
+    ImGui_ImplVulkan_BuildDrawBatches(draw_data, wrb, fb_width, fb_height);
+    const bool use_indirect = v->UseMultiDrawIndirect;
+
     if (draw_data->TotalVtxCount > 0)
     {
-        // Create or resize the vertex/index buffers
+        // Create, grow or shrink the buffer. Growing doubles the size; shrinking waits until the buffer
+        // has been less than a quarter full for IMGUI_IMPL_VULKAN_BUFFER_SHRINK_FRAMES frames in a row.
         VkDeviceSize vertex_size = AlignBufferSize(draw_data->TotalVtxCount * sizeof(ImDrawVert), bd->BufferMemoryAlignment);
         VkDeviceSize index_size = AlignBufferSize(draw_data->TotalIdxCount * sizeof(ImDrawIdx), bd->BufferMemoryAlignment);
-        if (rb->VertexBuffer == VK_NULL_HANDLE || rb->VertexBufferSize < vertex_size)
-            CreateOrResizeBuffer(rb->VertexBuffer, rb->VertexBufferMemory, rb->VertexBufferSize, vertex_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-        if (rb->IndexBuffer == VK_NULL_HANDLE || rb->IndexBufferSize < index_size)
-            CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
-
-        // Upload vertex/index data into a single contiguous GPU buffer
-        ImDrawVert* vtx_dst = nullptr;
-        ImDrawIdx* idx_dst = nullptr;
-        VkResult err = vkMapMemory(v->Device, rb->VertexBufferMemory, 0, vertex_size, 0, (void**)&vtx_dst);
-        check_vk_result(err);
-        err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, index_size, 0, (void**)&idx_dst);
-        check_vk_result(err);
+        VkDeviceSize indirect_size = use_indirect ? AlignBufferSize(wrb->Draws.size_in_bytes(), bd->BufferMemoryAlignment) : 0;
+        VkDeviceSize required_size = vertex_size + index_size + indirect_size;
+        if (rb->Buffer == VK_NULL_HANDLE || rb->BufferSize < required_size)
+            CreateOrResizeFrameRenderBuffer(rb, IM_MAX(required_size + required_size / 2, rb->BufferSize * 2));
+        else if (required_size * 4 < rb->BufferSize && ++rb->UnderusedFrames >= IMGUI_IMPL_VULKAN_BUFFER_SHRINK_FRAMES)
+            CreateOrResizeFrameRenderBuffer(rb, required_size * 2);
+        else if (required_size * 4 >= rb->BufferSize)
+            rb->UnderusedFrames = 0;
+
+        rb->IndexOffset = vertex_size;
+        rb->IndirectOffset = vertex_size + index_size;
+    }
+    return true;
+}
+
+static void ImGui_ImplVulkan_RecordDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline, ImGui_ImplVulkan_RenderStats* stats)
+{
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (pipeline == VK_NULL_HANDLE)
+        pipeline = bd->Pipeline;
+    ImGui_ImplVulkan_WindowRenderBuffers* wrb = &((ImGui_ImplVulkan_ViewportData*)draw_data->OwnerViewport->RendererUserData)->RenderBuffers;
+    ImGui_ImplVulkan_FrameRenderBuffers* rb = &wrb->FrameRenderBuffers[wrb->Index];
+    const bool use_indirect = v->UseMultiDrawIndirect;
+
+    if (draw_data->TotalVtxCount > 0 && !wrb->Reused)
+    {
+        // Upload vertex/index data into the mapped buffer, vertices first, then indices and indirect draws
+        ImDrawVert* vtx_dst = (ImDrawVert*)rb->Memory.MappedData;
+        ImDrawIdx* idx_dst = (ImDrawIdx*)((char*)rb->Memory.MappedData + rb->IndexOffset);
         for (const ImDrawList* draw_list : draw_data->CmdLists)
         {
             memcpy(vtx_dst, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
@@ -600,90 +1339,102 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
             vtx_dst += draw_list->VtxBuffer.Size;
             idx_dst += draw_list->IdxBuffer.Size;
         }
-        VkMappedMemoryRange range[2] = {};
-        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[0].memory = rb->VertexBufferMemory;
-        range[0].size = VK_WHOLE_SIZE;
-        range[1].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range[1].memory = rb->IndexBufferMemory;
-        range[1].size = VK_WHOLE_SIZE;
-        err = vkFlushMappedMemoryRanges(v->Device, 2, range);
-        check_vk_result(err);
-        vkUnmapMemory(v->Device, rb->VertexBufferMemory);
-        vkUnmapMemory(v->Device, rb->IndexBufferMemory);
+        if (use_indirect)
+            memcpy((char*)rb->Memory.MappedData + rb->IndirectOffset, wrb->Draws.Data, wrb->Draws.size_in_bytes());
+        if (!rb->Memory.IsCoherent)
+            FlushMappedBuffer(&rb->Memory, rb->IndirectOffset + (use_indirect ? wrb->Draws.size_in_bytes() : 0));
     }
 
     // Setup desired Vulkan state
     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
 
     // Setup render state structure (for callbacks and custom texture bindings)
+    // Draw data with callbacks is always recorded on the main thread, others don't touch platform_io.
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     ImGui_ImplVulkan_RenderState render_state;
     render_state.CommandBuffer = command_buffer;
     render_state.Pipeline = pipeline;
     render_state.PipelineLayout = bd->PipelineLayout;
-    platform_io.Renderer_RenderState = &render_state;
-
-    // Will project scissor/clipping rectangles into framebuffer space
-    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
-    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    if (wrb->HasCallbacks)
+        platform_io.Renderer_RenderState = &render_state;
 
-    // Render command lists
-    // (Because we merged all buffers into a single one, we maintain our own offset into them)
-    VkDescriptorSet last_desc_set = VK_NULL_HANDLE;
-    int global_vtx_offset = 0;
-    int global_idx_offset = 0;
+    // Render batches
     for (const ImDrawList* draw_list : draw_data->CmdLists)
+        stats->CmdsIn += draw_list->CmdBuffer.Size;
+    stats->DrawsMerged += wrb->Draws.Size;
+    bool scissor_set = false;
+    VkRect2D last_scissor = {};
+    VkDescriptorSet last_desc_set = VK_NULL_HANDLE;
+    uint32_t last_tex_index = (uint32_t)-1;
+    for (const ImGui_ImplVulkan_DrawBatch& batch : wrb->Batches)
     {
-        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        if (batch.CallbackList != nullptr)
         {
-            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
-            if (pcmd->UserCallback != nullptr)
+            // User callback, registered via ImDrawList::AddCallback()
+            // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+            if (batch.CallbackCmd->UserCallback == ImDrawCallback_ResetRenderState)
+                ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+            else
+                batch.CallbackCmd->UserCallback(batch.CallbackList, batch.CallbackCmd);
+            scissor_set = false;
+            last_desc_set = VK_NULL_HANDLE;
+            last_tex_index = (uint32_t)-1;
+            continue;
+        }
+
+        // Apply scissor/clipping rectangle
+        if (!scissor_set || memcmp(&last_scissor, &batch.Scissor, sizeof(VkRect2D)) != 0)
+        {
+            vkCmdSetScissor(command_buffer, 0, 1, &batch.Scissor);
+            last_scissor = batch.Scissor;
+            scissor_set = true;
+            stats->ScissorSets++;
+        }
+
+        // Bind DescriptorSet with font or user texture, or select it in the texture array
+        if (bd->BindlessSet != VK_NULL_HANDLE)
+        {
+            uint32_t tex_index = ImGui_ImplVulkan_BindlessIndex(batch.TexID);
+            if (tex_index != last_tex_index)
             {
-                // User callback, registered via ImDrawList::AddCallback()
-                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
-                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
-                    ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
-                else
-                    pcmd->UserCallback(draw_list, pcmd);
-                last_desc_set = VK_NULL_HANDLE;
+                vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(float) * 4, sizeof(uint32_t), &tex_index);
+                stats->TextureBinds++;
             }
-            else
+            last_tex_index = tex_index;
+        }
+        else
+        {
+            VkDescriptorSet desc_set = (VkDescriptorSet)batch.TexID;
+            if (desc_set != last_desc_set)
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-
-                // Clamp to viewport as vkCmdSetScissor() won't accept values that are off bounds
-                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
-                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
-                if (clip_max.x > fb_width) { clip_max.x = (float)fb_width; }
-                if (clip_max.y > fb_height) { clip_max.y = (float)fb_height; }
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                // Apply scissor/clipping rectangle
-                VkRect2D scissor;
-                scissor.offset.x = (int32_t)(clip_min.x);
-                scissor.offset.y = (int32_t)(clip_min.y);
-                scissor.extent.width = (uint32_t)(clip_max.x - clip_min.x);
-                scissor.extent.height = (uint32_t)(clip_max.y - clip_min.y);
-                vkCmdSetScissor(command_buffer, 0, 1, &scissor);
-
-                // Bind DescriptorSet with font or user texture
-                VkDescriptorSet desc_set = (VkDescriptorSet)pcmd->GetTexID();
-                if (desc_set != last_desc_set)
-                    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &desc_set, 0, nullptr);
-                last_desc_set = desc_set;
-
-                // Draw
-                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+                vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &desc_set, 0, nullptr);
+                stats->TextureBinds++;
             }
+            last_desc_set = desc_set;
+        }
+
+        // Draw
+        if (use_indirect)
+        {
+            for (uint32_t n = 0; n < batch.DrawCount; n += bd->MaxDrawIndirectCount)
+            {
+                uint32_t count = IM_MIN(batch.DrawCount - n, bd->MaxDrawIndirectCount);
+                vkCmdDrawIndexedIndirect(command_buffer, rb->Buffer, rb->IndirectOffset + (batch.FirstDraw + n) * sizeof(VkDrawIndexedIndirectCommand), count, sizeof(VkDrawIndexedIndirectCommand));
+                stats->DrawCalls++;
+            }
+        }
+        else
+        {
+            for (uint32_t n = 0; n < batch.DrawCount; n++)
+            {
+                const VkDrawIndexedIndirectCommand& draw = wrb->Draws[batch.FirstDraw + n];
+                vkCmdDrawIndexed(command_buffer, draw.indexCount, 1, draw.firstIndex, draw.vertexOffset, 0);
+            }
+            stats->DrawCalls += batch.DrawCount;
         }
-        global_idx_offset += draw_list->IdxBuffer.Size;
-        global_vtx_offset += draw_list->VtxBuffer.Size;
     }
-    platform_io.Renderer_RenderState = nullptr;
+    if (wrb->HasCallbacks)
+        platform_io.Renderer_RenderState = nullptr;
 
     // Note: at this point both vkCmdSetViewport() and vkCmdSetScissor() have been called.
     // Our last values will leak into user/application rendering IF:
@@ -696,6 +1447,14 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     vkCmdSetScissor(command_buffer, 0, 1, &scissor);
 }
 
+void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline)
+{
+    if (!ImGui_ImplVulkan_PrepareDrawData(draw_data))
+        return;
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_RecordDrawData(draw_data, command_buffer, pipeline, &bd->RenderStats);
+}
+
 static void ImGui_ImplVulkan_DestroyTexture(ImTextureData* tex)
 {
     if (ImGui_ImplVulkan_Texture* backend_tex = (ImGui_ImplVulkan_Texture*)tex->BackendUserData)
@@ -706,7 +1465,7 @@ static void ImGui_ImplVulkan_DestroyTexture(ImTextureData* tex)
         ImGui_ImplVulkan_RemoveTexture(backend_tex->DescriptorSet);
         vkDestroyImageView(v->Device, backend_tex->ImageView, v->Allocator);
         vkDestroyImage(v->Device, backend_tex->Image, v->Allocator);
-        vkFreeMemory(v->Device, backend_tex->Memory, v->Allocator);
+        ImGui_ImplVulkan_FreeMemory(&backend_tex->Memory);
         IM_DELETE(backend_tex);
 
         // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
@@ -752,13 +1511,8 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             check_vk_result(err);
             VkMemoryRequirements req;
             vkGetImageMemoryRequirements(v->Device, backend_tex->Image, &req);
-            VkMemoryAllocateInfo alloc_info = {};
-            alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-            alloc_info.allocationSize = IM_MAX(v->MinAllocationSize, req.size);
-            alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, req.memoryTypeBits);
-            err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &backend_tex->Memory);
-            check_vk_result(err);
-            err = vkBindImageMemory(v->Device, backend_tex->Image, backend_tex->Memory, 0);
+            ImGui_ImplVulkan_AllocateMemory(req, ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, req.memoryTypeBits), true, &backend_tex->Memory);
+            err = vkBindImageMemory(v->Device, backend_tex->Image, backend_tex->Memory.Memory, backend_tex->Memory.Offset);
             check_vk_result(err);
         }
 
@@ -789,66 +1543,68 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
         ImGui_ImplVulkan_Texture* backend_tex = (ImGui_ImplVulkan_Texture*)tex->BackendUserData;
 
         // Update full texture or selected blocks. We only ever write to textures regions which have never been used before!
-        // This backend choose to use tex->UpdateRect but you can use tex->Updates[] to upload individual regions.
         // We could use the smaller rect on _WantCreate but using the full rect allows us to clear the texture.
-        const int upload_x = (tex->Status == ImTextureStatus_WantCreate) ? 0 : tex->UpdateRect.x;
-        const int upload_y = (tex->Status == ImTextureStatus_WantCreate) ? 0 : tex->UpdateRect.y;
-        const int upload_w = (tex->Status == ImTextureStatus_WantCreate) ? tex->Width : tex->UpdateRect.w;
-        const int upload_h = (tex->Status == ImTextureStatus_WantCreate) ? tex->Height : tex->UpdateRect.h;
-
-        // Create the Upload Buffer:
-        VkDeviceMemory upload_buffer_memory;
-
-        VkBuffer upload_buffer;
-        VkDeviceSize upload_pitch = upload_w * tex->BytesPerPixel;
-        VkDeviceSize upload_size = AlignBufferSize(upload_h * upload_pitch, bd->NonCoherentAtomSize);
+        // Otherwise upload each of tex->Updates[] as its own region, unless the bounding box tex->UpdateRect costs less
+        // than the regions plus a fixed per-region overhead (e.g. many glyphs baked next to each other).
+        ImTextureRect full_rect = { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height };
+        const ImTextureRect* rects = &full_rect;
+        int rects_count = 1;
+        if (tex->Status == ImTextureStatus_WantUpdates)
         {
-            VkBufferCreateInfo buffer_info = {};
-            buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-            buffer_info.size = upload_size;
-            buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-            buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-            err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &upload_buffer);
-            check_vk_result(err);
-            VkMemoryRequirements req;
-            vkGetBufferMemoryRequirements(v->Device, upload_buffer, &req);
-            bd->BufferMemoryAlignment = (bd->BufferMemoryAlignment > req.alignment) ? bd->BufferMemoryAlignment : req.alignment;
-            VkMemoryAllocateInfo alloc_info = {};
-            alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-            alloc_info.allocationSize = IM_MAX(v->MinAllocationSize, req.size);
-            alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
-            err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &upload_buffer_memory);
-            check_vk_result(err);
-            err = vkBindBufferMemory(v->Device, upload_buffer, upload_buffer_memory, 0);
-            check_vk_result(err);
+            rects = &tex->UpdateRect;
+            if (tex->Updates.Size > 1)
+            {
+                VkDeviceSize regions_cost = 0;
+                for (const ImTextureRect& r : tex->Updates)
+                    regions_cost += (VkDeviceSize)r.w * r.h * tex->BytesPerPixel + IMGUI_IMPL_VULKAN_UPLOAD_REGION_COST;
+                VkDeviceSize union_cost = (VkDeviceSize)tex->UpdateRect.w * tex->UpdateRect.h * tex->BytesPerPixel + IMGUI_IMPL_VULKAN_UPLOAD_REGION_COST;
+                if (regions_cost < union_cost)
+                {
+                    rects = tex->Updates.Data;
+                    rects_count = tex->Updates.Size;
+                }
+                else
+                {
+                    bd->UploadStats.TotalUnionFallbacks++;
+                }
+            }
         }
 
-        // Upload to Buffer:
+        // Reserve staging memory for all regions at once. No idle wait: the slot is retired by its fence once the GPU is done with it.
+        ImVector<VkBufferImageCopy>& regions = bd->UploadRegions;
+        regions.resize(rects_count);
+        VkDeviceSize upload_size = 0;
+        for (int n = 0; n < rects_count; n++)
         {
-            char* map = nullptr;
-            err = vkMapMemory(v->Device, upload_buffer_memory, 0, upload_size, 0, (void**)(&map));
-            check_vk_result(err);
-            for (int y = 0; y < upload_h; y++)
-                memcpy(map + upload_pitch * y, tex->GetPixelsAt(upload_x, upload_y + y), (size_t)upload_pitch);
-            VkMappedMemoryRange range[1] = {};
-            range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-            range[0].memory = upload_buffer_memory;
-            range[0].size = upload_size;
-            err = vkFlushMappedMemoryRanges(v->Device, 1, range);
-            check_vk_result(err);
-            vkUnmapMemory(v->Device, upload_buffer_memory);
+            VkBufferImageCopy& region = regions[n];
+            memset(&region, 0, sizeof(region));
+            region.bufferOffset = upload_size;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.layerCount = 1;
+            region.imageExtent.width = rects[n].w;
+            region.imageExtent.height = rects[n].h;
+            region.imageExtent.depth = 1;
+            region.imageOffset.x = rects[n].x;
+            region.imageOffset.y = rects[n].y;
+            upload_size = AlignBufferSize(upload_size + (VkDeviceSize)rects[n].w * rects[n].h * tex->BytesPerPixel, 16); // bufferOffset must be a multiple of the texel size
         }
+        VkDeviceSize upload_offset = 0;
+        ImGui_ImplVulkan_UploadSlot* slot = ImGui_ImplVulkan_ReserveUpload(upload_size, &upload_offset);
+        VkCommandBuffer command_buffer = slot->CommandBuffer;
 
-        // Start command buffer
+        // Upload to Buffer:
+        for (VkBufferImageCopy& region : regions)
         {
-            err = vkResetCommandPool(v->Device, bd->TexCommandPool, 0);
-            check_vk_result(err);
-            VkCommandBufferBeginInfo begin_info = {};
-            begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-            begin_info.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            err = vkBeginCommandBuffer(bd->TexCommandBuffer, &begin_info);
-            check_vk_result(err);
+            region.bufferOffset += upload_offset;
+            char* map = (char*)slot->Memory.MappedData + region.bufferOffset;
+            const size_t upload_pitch = (size_t)region.imageExtent.width * tex->BytesPerPixel;
+            for (uint32_t y = 0; y < region.imageExtent.height; y++)
+                memcpy(map + upload_pitch * y, tex->GetPixelsAt(region.imageOffset.x, region.imageOffset.y + (int)y), upload_pitch);
         }
+        bd->UploadStats.FrameBytes += upload_size;
+        bd->UploadStats.FrameRegions += rects_count;
+        bd->UploadStats.FrameTextures++;
+        bd->UploadStats.TotalBytes += upload_size;
 
         // Copy to Image:
         {
@@ -858,8 +1614,8 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             upload_barrier[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
             upload_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
             upload_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            upload_barrier[0].buffer = upload_buffer;
-            upload_barrier[0].offset = 0;
+            upload_barrier[0].buffer = slot->Buffer;
+            upload_barrier[0].offset = upload_offset;
             upload_barrier[0].size = upload_size;
 
             VkImageMemoryBarrier copy_barrier[1] = {};
@@ -873,17 +1629,9 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             copy_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             copy_barrier[0].subresourceRange.levelCount = 1;
             copy_barrier[0].subresourceRange.layerCount = 1;
-            vkCmdPipelineBarrier(bd->TexCommandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, upload_barrier, 1, copy_barrier);
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, upload_barrier, 1, copy_barrier);
 
-            VkBufferImageCopy region = {};
-            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-            region.imageSubresource.layerCount = 1;
-            region.imageExtent.width = upload_w;
-            region.imageExtent.height = upload_h;
-            region.imageExtent.depth = 1;
-            region.imageOffset.x = upload_x;
-            region.imageOffset.y = upload_y;
-            vkCmdCopyBufferToImage(bd->TexCommandBuffer, upload_buffer, backend_tex->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+            vkCmdCopyBufferToImage(command_buffer, slot->Buffer, backend_tex->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.Size, regions.Data);
 
             VkImageMemoryBarrier use_barrier[1] = {};
             use_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -897,25 +1645,12 @@ void ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex)
             use_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             use_barrier[0].subresourceRange.levelCount = 1;
             use_barrier[0].subresourceRange.layerCount = 1;
-            vkCmdPipelineBarrier(bd->TexCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, use_barrier);
-        }
-
-        // End command buffer
-        {
-            VkSubmitInfo end_info = {};
-            end_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-            end_info.commandBufferCount = 1;
-            end_info.pCommandBuffers = &bd->TexCommandBuffer;
-            err = vkEndCommandBuffer(bd->TexCommandBuffer);
-            check_vk_result(err);
-            err = vkQueueSubmit(v->Queue, 1, &end_info, VK_NULL_HANDLE);
-            check_vk_result(err);
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, use_barrier);
         }
 
-        err = vkQueueWaitIdle(v->Queue); // FIXME-OPT: Suboptimal!
-        check_vk_result(err);
-        vkDestroyBuffer(v->Device, upload_buffer, v->Allocator);
-        vkFreeMemory(v->Device, upload_buffer_memory, v->Allocator);
+        // Outside of RenderDrawData() submit right away
+        if (!bd->UploadDeferSubmit)
+            ImGui_ImplVulkan_SubmitUploads();
 
         tex->SetStatus(ImTextureStatus_OK);
     }
@@ -942,8 +1677,8 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
     {
         VkShaderModuleCreateInfo default_frag_info = {};
         default_frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        default_frag_info.codeSize = sizeof(__glsl_shader_frag_spv);
-        default_frag_info.pCode = (uint32_t*)__glsl_shader_frag_spv;
+        default_frag_info.codeSize = v->UseDescriptorIndexing ? sizeof(__glsl_shader_bindless_frag_spv) : sizeof(__glsl_shader_frag_spv);
+        default_frag_info.pCode = v->UseDescriptorIndexing ? (uint32_t*)__glsl_shader_bindless_frag_spv : (uint32_t*)__glsl_shader_frag_spv;
         VkShaderModuleCreateInfo* p_frag_info = (v->CustomShaderFragCreateInfo.sType == VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO) ? &v->CustomShaderFragCreateInfo : &default_frag_info;
         VkResult err = vkCreateShaderModule(device, p_frag_info, allocator, &bd->ShaderModuleFrag);
         check_vk_result(err);
@@ -969,6 +1704,13 @@ static VkPipeline ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAlloc
     stage[1].module = bd->ShaderModuleFrag;
     stage[1].pName = "main";
 
+    // Size of the texture array in the descriptor indexing shader (ignored by other shaders)
+    const uint32_t max_textures = IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES;
+    VkSpecializationMapEntry spec_entry = { 0, 0, sizeof(uint32_t) };
+    VkSpecializationInfo spec_info = { 1, &spec_entry, sizeof(uint32_t), &max_textures };
+    if (bd->VulkanInitInfo.UseDescriptorIndexing)
+        stage[1].pSpecializationInfo = &spec_info;
+
     VkVertexInputBindingDescription binding_desc[1] = {};
     binding_desc[0].stride = sizeof(ImDrawVert);
     binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
@@ -1123,19 +1865,66 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
         check_vk_result(err);
     }
 
+#ifdef IMGUI_IMPL_VULKAN_HAS_DESCRIPTOR_INDEXING
+    if (v->UseDescriptorIndexing && !bd->BindlessSetLayout)
+    {
+        // One array of combined image samplers for all textures. Entries are written by ImGui_ImplVulkan_AddTexture() while
+        // earlier frames may still be in flight, which is what UPDATE_AFTER_BIND + UPDATE_UNUSED_WHILE_PENDING allow.
+        VkDescriptorSetLayoutBinding binding[1] = {};
+        binding[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding[0].descriptorCount = IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES;
+        binding[0].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        VkDescriptorBindingFlags binding_flags[1] = { VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT };
+        VkDescriptorSetLayoutBindingFlagsCreateInfo flags_info = {};
+        flags_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        flags_info.bindingCount = 1;
+        flags_info.pBindingFlags = binding_flags;
+        VkDescriptorSetLayoutCreateInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        info.pNext = &flags_info;
+        info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        info.bindingCount = 1;
+        info.pBindings = binding;
+        err = vkCreateDescriptorSetLayout(v->Device, &info, v->Allocator, &bd->BindlessSetLayout);
+        check_vk_result(err);
+
+        VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES };
+        VkDescriptorPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        pool_info.maxSets = 1;
+        pool_info.poolSizeCount = 1;
+        pool_info.pPoolSizes = &pool_size;
+        err = vkCreateDescriptorPool(v->Device, &pool_info, v->Allocator, &bd->BindlessPool);
+        check_vk_result(err);
+
+        VkDescriptorSetAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        alloc_info.descriptorPool = bd->BindlessPool;
+        alloc_info.descriptorSetCount = 1;
+        alloc_info.pSetLayouts = &bd->BindlessSetLayout;
+        err = vkAllocateDescriptorSets(v->Device, &alloc_info, &bd->BindlessSet);
+        check_vk_result(err);
+    }
+#endif
+
     if (!bd->PipelineLayout)
     {
         // Constants: we are using 'vec2 offset' and 'vec2 scale' instead of a full 3d projection matrix
-        VkPushConstantRange push_constants[1] = {};
+        // With descriptor indexing, the fragment shader additionally reads 'uint texture_index' right after them.
+        VkPushConstantRange push_constants[2] = {};
         push_constants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         push_constants[0].offset = sizeof(float) * 0;
         push_constants[0].size = sizeof(float) * 4;
-        VkDescriptorSetLayout set_layout[1] = { bd->DescriptorSetLayout };
+        push_constants[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        push_constants[1].offset = sizeof(float) * 4;
+        push_constants[1].size = sizeof(uint32_t);
+        VkDescriptorSetLayout set_layout[1] = { bd->BindlessSetLayout ? bd->BindlessSetLayout : bd->DescriptorSetLayout };
         VkPipelineLayoutCreateInfo layout_info = {};
         layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
         layout_info.setLayoutCount = 1;
         layout_info.pSetLayouts = set_layout;
-        layout_info.pushConstantRangeCount = 1;
+        layout_info.pushConstantRangeCount = bd->BindlessSetLayout ? 2 : 1;
         layout_info.pPushConstantRanges = push_constants;
         err = vkCreatePipelineLayout(v->Device, &layout_info, v->Allocator, &bd->PipelineLayout);
         check_vk_result(err);
@@ -1149,24 +1938,36 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
     if (create_main_pipeline)
         ImGui_ImplVulkan_CreateMainPipeline(&v->PipelineInfoMain);
 
-    // Create command pool/buffer for texture upload
-    if (!bd->TexCommandPool)
-    {
-        VkCommandPoolCreateInfo info = {};
-        info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        info.flags = 0;
-        info.queueFamilyIndex = v->QueueFamily;
-        err = vkCreateCommandPool(v->Device, &info, v->Allocator, &bd->TexCommandPool);
-        check_vk_result(err);
-    }
-    if (!bd->TexCommandBuffer)
+    // Create command pools/buffers and fences for texture upload. Staging buffers are created on first use.
+    for (int n = 0; n < IMGUI_IMPL_VULKAN_UPLOAD_SLOTS; n++)
     {
-        VkCommandBufferAllocateInfo info = {};
-        info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        info.commandPool = bd->TexCommandPool;
-        info.commandBufferCount = 1;
-        err = vkAllocateCommandBuffers(v->Device, &info, &bd->TexCommandBuffer);
-        check_vk_result(err);
+        ImGui_ImplVulkan_UploadSlot* slot = &bd->UploadSlots[n];
+        if (!slot->CommandPool)
+        {
+            VkCommandPoolCreateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            info.queueFamilyIndex = v->QueueFamily;
+            err = vkCreateCommandPool(v->Device, &info, v->Allocator, &slot->CommandPool);
+            check_vk_result(err);
+        }
+        if (!slot->CommandBuffer)
+        {
+            VkCommandBufferAllocateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            info.commandPool = slot->CommandPool;
+            info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            info.commandBufferCount = 1;
+            err = vkAllocateCommandBuffers(v->Device, &info, &slot->CommandBuffer);
+            check_vk_result(err);
+        }
+        if (!slot->Fence)
+        {
+            VkFenceCreateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            err = vkCreateFence(v->Device, &info, v->Allocator, &slot->Fence);
+            check_vk_result(err);
+        }
     }
 
     return true;
@@ -1206,13 +2007,34 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     ImGui_ImplVulkanH_DestroyAllViewportsRenderBuffers(v->Device, v->Allocator);
 
+    // Retire uploads still in flight before their textures and staging buffers go away
+    ImGui_ImplVulkan_SubmitUploads();
+    for (int n = 0; n < IMGUI_IMPL_VULKAN_UPLOAD_SLOTS; n++)
+    {
+        ImGui_ImplVulkan_UploadSlot* slot = &bd->UploadSlots[n];
+        if (slot->Pending)
+        {
+            VkResult err = vkWaitForFences(v->Device, 1, &slot->Fence, VK_TRUE, UINT64_MAX);
+            check_vk_result(err);
+            slot->Pending = false;
+        }
+    }
+
     // Destroy all textures
     for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
         if (tex->RefCount == 1)
             ImGui_ImplVulkan_DestroyTexture(tex);
 
-    if (bd->TexCommandBuffer)     { vkFreeCommandBuffers(v->Device, bd->TexCommandPool, 1, &bd->TexCommandBuffer); bd->TexCommandBuffer = VK_NULL_HANDLE; }
-    if (bd->TexCommandPool)       { vkDestroyCommandPool(v->Device, bd->TexCommandPool, v->Allocator); bd->TexCommandPool = VK_NULL_HANDLE; }
+    for (int n = 0; n < IMGUI_IMPL_VULKAN_UPLOAD_SLOTS; n++)
+    {
+        ImGui_ImplVulkan_UploadSlot* slot = &bd->UploadSlots[n];
+        DestroyUploadSlotBuffer(slot);
+        if (slot->CommandBuffer)  { vkFreeCommandBuffers(v->Device, slot->CommandPool, 1, &slot->CommandBuffer); slot->CommandBuffer = VK_NULL_HANDLE; }
+        if (slot->CommandPool)    { vkDestroyCommandPool(v->Device, slot->CommandPool, v->Allocator); slot->CommandPool = VK_NULL_HANDLE; }
+        if (slot->Fence)          { vkDestroyFence(v->Device, slot->Fence, v->Allocator); slot->Fence = VK_NULL_HANDLE; }
+        slot->Used = 0;
+    }
+    bd->UploadSlotIndex = 0;
     if (bd->TexSamplerLinear)     { vkDestroySampler(v->Device, bd->TexSamplerLinear, v->Allocator); bd->TexSamplerLinear = VK_NULL_HANDLE; }
     if (bd->ShaderModuleVert)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleVert, v->Allocator); bd->ShaderModuleVert = VK_NULL_HANDLE; }
     if (bd->ShaderModuleFrag)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleFrag, v->Allocator); bd->ShaderModuleFrag = VK_NULL_HANDLE; }
@@ -1221,6 +2043,12 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     if (bd->Pipeline)             { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
     if (bd->PipelineForViewports) { vkDestroyPipeline(v->Device, bd->PipelineForViewports, v->Allocator); bd->PipelineForViewports = VK_NULL_HANDLE; }
     if (bd->DescriptorPool)       { vkDestroyDescriptorPool(v->Device, bd->DescriptorPool, v->Allocator); bd->DescriptorPool = VK_NULL_HANDLE; }
+    if (bd->BindlessPool)         { vkDestroyDescriptorPool(v->Device, bd->BindlessPool, v->Allocator); bd->BindlessPool = VK_NULL_HANDLE; bd->BindlessSet = VK_NULL_HANDLE; }
+    if (bd->BindlessSetLayout)    { vkDestroyDescriptorSetLayout(v->Device, bd->BindlessSetLayout, v->Allocator); bd->BindlessSetLayout = VK_NULL_HANDLE; }
+    bd->BindlessEntries.clear();
+    bd->BindlessFreeIndices.clear();
+    bd->BindlessNextIndex = 0;
+    ImGui_ImplVulkan_CompactMemory();
 }
 
 #ifdef IMGUI_IMPL_VULKAN_HAS_DYNAMIC_RENDERING
@@ -1327,12 +2155,17 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
         IM_ASSERT(info->DescriptorPoolSize > 0);
     if (info->UseDynamicRendering)
         IM_ASSERT(info->PipelineInfoMain.RenderPass == VK_NULL_HANDLE && info->PipelineInfoForViewports.RenderPass == VK_NULL_HANDLE);
+#ifndef IMGUI_IMPL_VULKAN_HAS_DESCRIPTOR_INDEXING
+    IM_ASSERT(!info->UseDescriptorIndexing && "UseDescriptorIndexing requires Vulkan 1.2 headers");
+#endif
 
     bd->VulkanInitInfo = *info;
 
     VkPhysicalDeviceProperties properties;
     vkGetPhysicalDeviceProperties(info->PhysicalDevice, &properties);
     bd->NonCoherentAtomSize = properties.limits.nonCoherentAtomSize;
+    bd->MaxDrawIndirectCount = IM_MAX(properties.limits.maxDrawIndirectCount, 1u);
+    vkGetPhysicalDeviceMemoryProperties(info->PhysicalDevice, &bd->MemoryProperties);
 
     if (!ImGui_ImplVulkan_CreateDeviceObjects())
         IM_ASSERT(0 && "ImGui_ImplVulkan_CreateDeviceObjects() failed!"); // <- Can't be hit yet.
@@ -1365,6 +2198,15 @@ void ImGui_ImplVulkan_Shutdown()
     // Clean up windows
     ImGui_ImplVulkan_ShutdownMultiViewportSupport();
 
+    // Release memory blocks. Only textures shared with another context (RefCount > 1) can still live in them.
+    for (ImGui_ImplVulkan_MemoryPool& pool : bd->MemoryPools)
+    {
+        while (pool.Blocks.Size > 0)
+            ImGui_ImplVulkan_DestroyMemoryBlock(pool.Blocks.back());
+        pool.Blocks.clear();
+    }
+    bd->MemoryPools.clear();
+
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
     io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasViewports);
@@ -1376,7 +2218,83 @@ void ImGui_ImplVulkan_NewFrame()
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
-    IM_UNUSED(bd);
+    ImGui_ImplVulkan_SubmitViewports(); // In case the app rendered viewports without calling ImGui_ImplVulkan_SwapBuffers()
+    bd->UploadStats.FrameBytes = 0;
+    bd->UploadStats.FrameRegions = 0;
+    bd->UploadStats.FrameTextures = 0;
+    memset((void*)&bd->RenderStats, 0, sizeof(bd->RenderStats));
+}
+
+const ImGui_ImplVulkan_RenderStats* ImGui_ImplVulkan_GetRenderStats()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    return &bd->RenderStats;
+}
+
+void ImGui_ImplVulkan_GetMemoryStats(ImGui_ImplVulkan_MemoryStats* out_stats)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    memset((void*)out_stats, 0, sizeof(*out_stats));
+    out_stats->DedicatedCount = bd->MemoryDedicatedCount;
+    out_stats->DedicatedBytes = bd->MemoryDedicatedBytes;
+    for (const ImGui_ImplVulkan_MemoryPool& pool : bd->MemoryPools)
+        for (const ImGui_ImplVulkan_MemoryBlock* block : pool.Blocks)
+        {
+            out_stats->BlockCount++;
+            out_stats->AllocationCount += block->AllocationCount;
+            out_stats->BlockBytes += IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE;
+            out_stats->UsedBytes += block->UsedBytes;
+            out_stats->RequestedBytes += block->RequestedBytes;
+            for (int order = IMGUI_IMPL_VULKAN_MEMORY_MAX_ORDERS - 1; order >= 0; order--)
+                if (block->FreeNodes[order].Size > 0)
+                {
+                    out_stats->LargestFreeNode = IM_MAX(out_stats->LargestFreeNode, (ImU64)IMGUI_IMPL_VULKAN_MEMORY_MIN_NODE_SIZE << order);
+                    break;
+                }
+        }
+}
+
+// Live allocations are never moved: textures would need a copy and new descriptors, and frame buffers may be in flight.
+// Instead, idle staging buffers are released (they are recreated on the next upload) and blocks left empty go back to the driver.
+VkDeviceSize ImGui_ImplVulkan_CompactMemory()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    for (int n = 0; n < IMGUI_IMPL_VULKAN_UPLOAD_SLOTS; n++)
+    {
+        ImGui_ImplVulkan_UploadSlot* slot = &bd->UploadSlots[n];
+        if (slot->Recording)
+            continue;
+        if (slot->Pending)
+        {
+            if (vkGetFenceStatus(v->Device, slot->Fence) != VK_SUCCESS)
+                continue;
+            VkResult err = vkResetFences(v->Device, 1, &slot->Fence);
+            check_vk_result(err);
+            slot->Pending = false;
+        }
+        DestroyUploadSlotBuffer(slot);
+    }
+
+    VkDeviceSize freed = 0;
+    for (ImGui_ImplVulkan_MemoryPool& pool : bd->MemoryPools)
+        for (int n = pool.Blocks.Size - 1; n >= 0; n--)
+            if (pool.Blocks[n]->AllocationCount == 0)
+            {
+                ImGui_ImplVulkan_DestroyMemoryBlock(pool.Blocks[n]);
+                freed += IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE;
+            }
+    return freed;
+}
+
+const ImGui_ImplVulkan_UploadStats* ImGui_ImplVulkan_GetUploadStats()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplVulkan_Init()?");
+    return &bd->UploadStats;
 }
 
 void ImGui_ImplVulkan_SetMinImageCount(uint32_t min_image_count)
@@ -1428,6 +2346,27 @@ VkDescriptorSet ImGui_ImplVulkan_AddTexture(VkSampler sampler, VkImageView image
         write_desc[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
         write_desc[0].pImageInfo = desc_image;
         vkUpdateDescriptorSets(v->Device, 1, write_desc, 0, nullptr);
+
+        // Also write it into the texture array and remember its index
+        if (bd->BindlessSet != VK_NULL_HANDLE)
+        {
+            uint32_t index;
+            if (!bd->BindlessFreeIndices.empty())
+            {
+                index = bd->BindlessFreeIndices.back();
+                bd->BindlessFreeIndices.pop_back();
+            }
+            else
+            {
+                IM_ASSERT(bd->BindlessNextIndex < IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES && "Too many textures, increase IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES");
+                index = bd->BindlessNextIndex++;
+            }
+            write_desc[0].dstSet = bd->BindlessSet;
+            write_desc[0].dstArrayElement = index;
+            vkUpdateDescriptorSets(v->Device, 1, write_desc, 0, nullptr);
+            ImGui_ImplVulkan_BindlessEntry entry = { (ImTextureID)descriptor_set, index };
+            bd->BindlessEntries.insert(bd->BindlessEntries.Data + ImGui_ImplVulkan_BindlessLowerBound(entry.TexID), entry);
+        }
     }
     return descriptor_set;
 }
@@ -1437,17 +2376,26 @@ void ImGui_ImplVulkan_RemoveTexture(VkDescriptorSet descriptor_set)
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     VkDescriptorPool pool = bd->DescriptorPool ? bd->DescriptorPool : v->DescriptorPool;
+    if (bd->BindlessSet != VK_NULL_HANDLE)
+    {
+        // The array entry is left as is: PARTIALLY_BOUND tolerates stale entries and the index is rewritten on reuse.
+        int n = ImGui_ImplVulkan_BindlessLowerBound((ImTextureID)descriptor_set);
+        if (n < bd->BindlessEntries.Size && bd->BindlessEntries[n].TexID == (ImTextureID)descriptor_set)
+        {
+            bd->BindlessFreeIndices.push_back(bd->BindlessEntries[n].Index);
+            bd->BindlessEntries.erase(bd->BindlessEntries.Data + n);
+        }
+    }
     vkFreeDescriptorSets(v->Device, pool, 1, &descriptor_set);
 }
 
 void ImGui_ImplVulkan_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulkan_FrameRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
 {
-    if (buffers->VertexBuffer) { vkDestroyBuffer(device, buffers->VertexBuffer, allocator); buffers->VertexBuffer = VK_NULL_HANDLE; }
-    if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
-    if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
-    if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
-    buffers->VertexBufferSize = 0;
-    buffers->IndexBufferSize = 0;
+    if (buffers->Buffer) { vkDestroyBuffer(device, buffers->Buffer, allocator); buffers->Buffer = VK_NULL_HANDLE; }
+    ImGui_ImplVulkan_FreeMemory(&buffers->Memory);
+    buffers->BufferSize = 0;
+    buffers->IndexOffset = 0;
+    buffers->IndirectOffset = 0;
 }
 
 void ImGui_ImplVulkan_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkan_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
@@ -1455,8 +2403,12 @@ void ImGui_ImplVulkan_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulk
     for (uint32_t n = 0; n < buffers->Count; n++)
         ImGui_ImplVulkan_DestroyFrameRenderBuffers(device, &buffers->FrameRenderBuffers[n], allocator);
     buffers->FrameRenderBuffers.clear();
+    buffers->Draws.clear();
+    buffers->Batches.clear();
     buffers->Index = 0;
     buffers->Count = 0;
+    buffers->FrameHash = 0;
+    buffers->HashDrawData = nullptr;
 }
 
 //-------------------------------------------------------------------------
@@ -1928,6 +2880,7 @@ void ImGui_ImplVulkanH_DestroyFrame(VkDevice device, ImGui_ImplVulkanH_Frame* fd
     vkDestroyCommandPool(device, fd->CommandPool, allocator);
     fd->Fence = VK_NULL_HANDLE;
     fd->CommandBuffer = VK_NULL_HANDLE;
+    fd->SecondaryCommandBuffer = VK_NULL_HANDLE; // Freed with the pool
     fd->CommandPool = VK_NULL_HANDLE;
 
     vkDestroyImageView(device, fd->BackbufferView, allocator);
@@ -2032,7 +2985,7 @@ static void ImGui_ImplVulkan_CreateWindow(ImGuiViewport* viewport)
             pipeline_info->RenderPass = wd->RenderPass;
         }
 #endif
-        bd->PipelineForViewports = ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, VK_NULL_HANDLE, &v->PipelineInfoForViewports);
+        bd->PipelineForViewports = ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, &v->PipelineInfoForViewports);
     }
 }
 
@@ -2040,6 +2993,7 @@ static void ImGui_ImplVulkan_DestroyWindow(ImGuiViewport* viewport)
 {
     // The main viewport (owned by the application) will always have RendererUserData == 0 since we didn't create the data for it.
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_SubmitViewports();
     if (ImGui_ImplVulkan_ViewportData* vd = (ImGui_ImplVulkan_ViewportData*)viewport->RendererUserData)
     {
         ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
@@ -2150,6 +3104,8 @@ static void ImGui_ImplVulkan_RenderWindow(ImGuiViewport* viewport, void*)
             renderingInfo.viewMask = 0;
             renderingInfo.colorAttachmentCount = 1;
             renderingInfo.pColorAttachments = &attachmentInfo;
+            if (v->ParallelForFn != nullptr)
+                renderingInfo.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR;
 
             ImGuiImplVulkanFuncs_vkCmdBeginRenderingKHR(fd->CommandBuffer, &renderingInfo);
         }
@@ -2164,12 +3120,67 @@ static void ImGui_ImplVulkan_RenderWindow(ImGuiViewport* viewport, void*)
             info.renderArea.extent.height = wd->Height;
             info.clearValueCount = (viewport->Flags & ImGuiViewportFlags_NoRendererClear) ? 0 : 1;
             info.pClearValues = (viewport->Flags & ImGuiViewportFlags_NoRendererClear) ? nullptr : &wd->ClearValue;
-            vkCmdBeginRenderPass(fd->CommandBuffer, &info, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBeginRenderPass(fd->CommandBuffer, &info, (v->ParallelForFn != nullptr) ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
         }
     }
 
+    if (v->ParallelForFn != nullptr)
+    {
+        // Record into the frame's secondary command buffer. Viewports without user callbacks are left to
+        // ImGui_ImplVulkan_SubmitViewports(), called by the first ImGui_ImplVulkan_SwapBuffers() of the frame.
+        if (fd->SecondaryCommandBuffer == VK_NULL_HANDLE)
+        {
+            VkCommandBufferAllocateInfo info = {};
+            info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            info.commandPool = fd->CommandPool;
+            info.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            info.commandBufferCount = 1;
+            err = vkAllocateCommandBuffers(v->Device, &info, &fd->SecondaryCommandBuffer);
+            check_vk_result(err);
+        }
+        vd->SecondaryRecorded = vd->SecondaryDeferred = false;
+        if (ImGui_ImplVulkan_PrepareDrawData(viewport->DrawData))
+        {
+            vd->SecondaryRecorded = true;
+            if (vd->RenderBuffers.HasCallbacks)
+                ImGui_ImplVulkan_RecordViewport(viewport); // User callbacks run on the thread which owns the context
+            else
+                vd->SecondaryDeferred = true;
+        }
+        bd->PendingViewports.push_back(viewport);
+        return;
+    }
+
     ImGui_ImplVulkan_RenderDrawData(viewport->DrawData, fd->CommandBuffer, bd->PipelineForViewports);
+    ImGui_ImplVulkan_EndViewportCommands(viewport);
+    {
+        VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        VkSubmitInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        info.waitSemaphoreCount = 1;
+        info.pWaitSemaphores = &fsd->ImageAcquiredSemaphore;
+        info.pWaitDstStageMask = &wait_stage;
+        info.commandBufferCount = 1;
+        info.pCommandBuffers = &fd->CommandBuffer;
+        info.signalSemaphoreCount = 1;
+        info.pSignalSemaphores = &fsd->RenderCompleteSemaphore;
+
+        err = vkResetFences(v->Device, 1, &fd->Fence);
+        check_vk_result(err);
+        err = vkQueueSubmit(v->Queue, 1, &info, fd->Fence);
+        check_vk_result(err);
+    }
+}
 
+// Close the render pass and the primary command buffer of the viewport's current frame.
+static void ImGui_ImplVulkan_EndViewportCommands(ImGuiViewport* viewport)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_ViewportData* vd = (ImGui_ImplVulkan_ViewportData*)viewport->RendererUserData;
+    ImGui_ImplVulkanH_Window* wd = &vd->Window;
+    ImGui_ImplVulkanH_Frame* fd = &wd->Frames[wd->FrameIndex];
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    IM_UNUSED(v);
     {
 #ifdef IMGUI_IMPL_VULKAN_HAS_DYNAMIC_RENDERING
         if (v->UseDynamicRendering)
@@ -2193,31 +3204,130 @@ static void ImGui_ImplVulkan_RenderWindow(ImGuiViewport* viewport, void*)
         {
             vkCmdEndRenderPass(fd->CommandBuffer);
         }
-        {
-            VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-            VkSubmitInfo info = {};
-            info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-            info.waitSemaphoreCount = 1;
-            info.pWaitSemaphores = &fsd->ImageAcquiredSemaphore;
-            info.pWaitDstStageMask = &wait_stage;
-            info.commandBufferCount = 1;
-            info.pCommandBuffers = &fd->CommandBuffer;
-            info.signalSemaphoreCount = 1;
-            info.pSignalSemaphores = &fsd->RenderCompleteSemaphore;
+        VkResult err = vkEndCommandBuffer(fd->CommandBuffer);
+        check_vk_result(err);
+    }
+}
 
-            err = vkEndCommandBuffer(fd->CommandBuffer);
-            check_vk_result(err);
-            err = vkResetFences(v->Device, 1, &fd->Fence);
-            check_vk_result(err);
-            err = vkQueueSubmit(v->Queue, 1, &info, fd->Fence);
-            check_vk_result(err);
+// Record the viewport's draw data into the secondary command buffer of its current frame.
+// Only touches the viewport's own command pool and buffers: ParallelForFn may run it on any thread.
+static void ImGui_ImplVulkan_RecordViewport(ImGuiViewport* viewport)
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_ViewportData* vd = (ImGui_ImplVulkan_ViewportData*)viewport->RendererUserData;
+    ImGui_ImplVulkanH_Window* wd = &vd->Window;
+    ImGui_ImplVulkanH_Frame* fd = &wd->Frames[wd->FrameIndex];
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+
+    VkCommandBufferInheritanceInfo inheritance = {};
+    inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+#ifdef IMGUI_IMPL_VULKAN_HAS_DYNAMIC_RENDERING
+    VkCommandBufferInheritanceRenderingInfo inheritance_rendering = {};
+    if (v->UseDynamicRendering)
+    {
+        inheritance_rendering.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+        inheritance_rendering.colorAttachmentCount = 1;
+        inheritance_rendering.pColorAttachmentFormats = &wd->SurfaceFormat.format;
+        inheritance_rendering.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+        inheritance.pNext = &inheritance_rendering;
+    }
+    else
+#endif
+    {
+        inheritance.renderPass = wd->RenderPass;
+        inheritance.subpass = v->PipelineInfoForViewports.Subpass;
+        inheritance.framebuffer = fd->Framebuffer;
+    }
+    VkCommandBufferBeginInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    info.pInheritanceInfo = &inheritance;
+    VkResult err = vkBeginCommandBuffer(fd->SecondaryCommandBuffer, &info);
+    check_vk_result(err);
+    memset((void*)&vd->SecondaryStats, 0, sizeof(vd->SecondaryStats));
+    ImGui_ImplVulkan_RecordDrawData(viewport->DrawData, fd->SecondaryCommandBuffer, bd->PipelineForViewports, &vd->SecondaryStats);
+    err = vkEndCommandBuffer(fd->SecondaryCommandBuffer);
+    check_vk_result(err);
+}
+
+static void ImGui_ImplVulkan_RecordViewportJob(int job_index, void* job_data)
+{
+    ImGui_ImplVulkan_Data* bd = (ImGui_ImplVulkan_Data*)job_data;
+    ImGui_ImplVulkan_RecordViewport(bd->RecordViewports[job_index]);
+}
+
+// Record the viewports queued by ImGui_ImplVulkan_RenderWindow() through ParallelForFn, then submit all of them with one vkQueueSubmit().
+// Each frame keeps its own fence so the next ImGui_ImplVulkan_RenderWindow() can wait on it: the fences after the first
+// are signaled by empty submissions, which complete once the batches submitted before them have.
+static void ImGui_ImplVulkan_SubmitViewports()
+{
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    if (bd == nullptr || bd->PendingViewports.Size == 0)
+        return;
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    VkResult err;
+
+    bd->RecordViewports.resize(0);
+    for (ImGuiViewport* viewport : bd->PendingViewports)
+        if (((ImGui_ImplVulkan_ViewportData*)viewport->RendererUserData)->SecondaryDeferred)
+            bd->RecordViewports.push_back(viewport);
+    if (bd->RecordViewports.Size == 1)
+        ImGui_ImplVulkan_RecordViewport(bd->RecordViewports[0]);
+    else if (bd->RecordViewports.Size > 1)
+        v->ParallelForFn(bd->RecordViewports.Size, ImGui_ImplVulkan_RecordViewportJob, bd);
+
+    static const VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    bd->PendingSubmitInfos.resize(0);
+    for (ImGuiViewport* viewport : bd->PendingViewports)
+    {
+        ImGui_ImplVulkan_ViewportData* vd = (ImGui_ImplVulkan_ViewportData*)viewport->RendererUserData;
+        ImGui_ImplVulkanH_Window* wd = &vd->Window;
+        ImGui_ImplVulkanH_Frame* fd = &wd->Frames[wd->FrameIndex];
+        ImGui_ImplVulkanH_FrameSemaphores* fsd = &wd->FrameSemaphores[wd->SemaphoreIndex];
+        if (vd->SecondaryRecorded)
+        {
+            vkCmdExecuteCommands(fd->CommandBuffer, 1, &fd->SecondaryCommandBuffer);
+            ImGui_ImplVulkan_RenderStats* stats = &bd->RenderStats;
+            stats->CmdsIn += vd->SecondaryStats.CmdsIn;
+            stats->DrawsMerged += vd->SecondaryStats.DrawsMerged;
+            stats->DrawCalls += vd->SecondaryStats.DrawCalls;
+            stats->ScissorSets += vd->SecondaryStats.ScissorSets;
+            stats->TextureBinds += vd->SecondaryStats.TextureBinds;
         }
+        vd->SecondaryRecorded = vd->SecondaryDeferred = false;
+        ImGui_ImplVulkan_EndViewportCommands(viewport);
+        err = vkResetFences(v->Device, 1, &fd->Fence);
+        check_vk_result(err);
+
+        VkSubmitInfo info = {};
+        info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        info.waitSemaphoreCount = 1;
+        info.pWaitSemaphores = &fsd->ImageAcquiredSemaphore;
+        info.pWaitDstStageMask = &wait_stage;
+        info.commandBufferCount = 1;
+        info.pCommandBuffers = &fd->CommandBuffer;
+        info.signalSemaphoreCount = 1;
+        info.pSignalSemaphores = &fsd->RenderCompleteSemaphore;
+        bd->PendingSubmitInfos.push_back(info);
+    }
+
+    for (int n = 0; n < bd->PendingViewports.Size; n++)
+    {
+        ImGui_ImplVulkanH_Window* wd = &((ImGui_ImplVulkan_ViewportData*)bd->PendingViewports[n]->RendererUserData)->Window;
+        VkFence fence = wd->Frames[wd->FrameIndex].Fence;
+        if (n == 0)
+            err = vkQueueSubmit(v->Queue, (uint32_t)bd->PendingSubmitInfos.Size, bd->PendingSubmitInfos.Data, fence);
+        else
+            err = vkQueueSubmit(v->Queue, 0, nullptr, fence);
+        check_vk_result(err);
     }
+    bd->PendingViewports.resize(0);
 }
 
 static void ImGui_ImplVulkan_SwapBuffers(ImGuiViewport* viewport, void*)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_SubmitViewports();
     ImGui_ImplVulkan_ViewportData* vd = (ImGui_ImplVulkan_ViewportData*)viewport->RendererUserData;
     if (vd == nullptr)
         return;
@@ -71,6 +71,14 @@
 #if defined(VK_VERSION_1_3) || defined(VK_KHR_dynamic_rendering)
 #define IMGUI_IMPL_VULKAN_HAS_DYNAMIC_RENDERING
 #endif
+#if defined(VK_VERSION_1_2)
+#define IMGUI_IMPL_VULKAN_HAS_DESCRIPTOR_INDEXING
+#endif
+
+// Size of the texture array used with ImGui_ImplVulkan_InitInfo::UseDescriptorIndexing. Must not exceed maxPerStageDescriptorUpdateAfterBindSamplers.
+#ifndef IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES
+#define IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES             (1024)
+#endif
 
 // Backend uses a small number of descriptors per font atlas + as many as additional calls done to ImGui_ImplVulkan_AddTexture().
 #define IMGUI_IMPL_VULKAN_MINIMUM_IMAGE_SAMPLER_POOL_SIZE   (8)     // Minimum per atlas
@@ -126,6 +134,33 @@ struct ImGui_ImplVulkan_InitInfo
     // Need to explicitly enable VK_KHR_dynamic_rendering extension to use this, even for Vulkan 1.3 + setup PipelineInfoMain.PipelineRenderingCreateInfo and PipelineInfoViewports.PipelineRenderingCreateInfo.
     bool                            UseDynamicRendering;
 
+    // (Optional) Descriptor Indexing
+    // Sample all textures from one descriptor array, selected with a push constant, instead of binding one descriptor set per texture.
+    // Need Vulkan 1.2 (or VK_EXT_descriptor_indexing) with descriptorBindingPartiallyBound, descriptorBindingSampledImageUpdateAfterBind,
+    // descriptorBindingUpdateUnusedWhilePending and shaderSampledImageArrayDynamicIndexing enabled on the device.
+    // ImTextureID is still the VkDescriptorSet returned by ImGui_ImplVulkan_AddTexture(), but every texture must be registered through it.
+    // The pipeline layout in ImGui_ImplVulkan_RenderState uses the array's set layout: callbacks can't bind their own set 0 with it.
+    bool                            UseDescriptorIndexing;
+
+    // (Optional) Indirect Draws
+    // Submit merged draws with vkCmdDrawIndexedIndirect(), one call per run of draws sharing scissor and texture.
+    // Need the multiDrawIndirect feature enabled on the device. Otherwise merged draws are issued with vkCmdDrawIndexed().
+    bool                            UseMultiDrawIndirect;
+
+    // (Optional) Identical frame detection
+    // Hash vertices, indices, draw commands and texture IDs of each viewport's draw data (draw data with user callbacks never matches).
+    // A frame identical to the previous one of its viewport skips the upload and the merge step and draws from the previous buffer.
+    // The host may go further and skip recording, submitting and presenting the frame when ImGui_ImplVulkan_IsFrameUnchanged() returns true.
+    bool                            UseFrameHash;
+
+    // (Optional) Parallel recording of secondary viewports
+    // When set, each secondary viewport is recorded into a secondary command buffer allocated from its frame's command pool,
+    // and the first Renderer_SwapBuffers() call of the frame submits all viewports with a single vkQueueSubmit().
+    // Must call job(i, job_data) once for each i in [0, job_count), on any threads, and return after all calls have finished.
+    // Texture updates and viewports with user callbacks stay on the calling thread. Worker threads read the current
+    // Dear ImGui context, so this requires the default global GImGui (not a thread-local one).
+    void                            (*ParallelForFn)(int job_count, void (*job)(int job_index, void* job_data), void* job_data);
+
     // (Optional) Allocation, Debugging
     const VkAllocationCallbacks*    Allocator;
     void                            (*CheckVkResultFn)(VkResult err);
@@ -153,6 +188,59 @@ IMGUI_IMPL_API void             ImGui_ImplVulkan_CreateMainPipeline(const ImGui_
 // (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = nullptr to handle this manually.
 IMGUI_IMPL_API void             ImGui_ImplVulkan_UpdateTexture(ImTextureData* tex);
 
+// (Advanced) Texture upload statistics. Frame counters are reset by ImGui_ImplVulkan_NewFrame(), totals accumulate since ImGui_ImplVulkan_Init().
+struct ImGui_ImplVulkan_UploadStats
+{
+    ImU64               FrameBytes;             // Bytes written to staging memory this frame
+    int                 FrameRegions;           // VkBufferImageCopy regions recorded this frame
+    int                 FrameTextures;          // Textures created or updated this frame
+    ImU64               TotalBytes;
+    int                 TotalUnionFallbacks;    // Updates uploaded as tex->UpdateRect because it was cheaper than the separate tex->Updates[]
+    int                 TotalSlotWaits;         // Uploads which had to wait for the GPU to release a staging slot
+};
+IMGUI_IMPL_API const ImGui_ImplVulkan_UploadStats* ImGui_ImplVulkan_GetUploadStats();
+
+// (Advanced) Draw statistics, summed over all viewports rendered since the last ImGui_ImplVulkan_NewFrame().
+struct ImGui_ImplVulkan_RenderStats
+{
+    int                 CmdsIn;                 // ImDrawCmd in all draw lists, callbacks included
+    int                 DrawsMerged;            // Draws left after merging adjacent commands
+    int                 DrawCalls;              // vkCmdDrawIndexed() or vkCmdDrawIndexedIndirect() calls issued
+    int                 ScissorSets;            // vkCmdSetScissor() calls issued
+    int                 TextureBinds;           // vkCmdBindDescriptorSets() or texture index pushes issued
+};
+IMGUI_IMPL_API const ImGui_ImplVulkan_RenderStats* ImGui_ImplVulkan_GetRenderStats();
+
+// (Advanced) Identical frame detection with UseFrameHash. Returns true when draw_data matches the draw data last rendered for its
+// viewport and no texture needs an update: the host may then skip rendering and presenting this frame.
+// Counters are per hashed draw data (one per viewport and frame), summed since ImGui_ImplVulkan_Init().
+struct ImGui_ImplVulkan_FrameHashStats
+{
+    ImU64               Hits;                   // Draw data identical to the previous frame of its viewport
+    ImU64               Misses;
+    ImU64               HashedBytes;
+};
+IMGUI_IMPL_API bool     ImGui_ImplVulkan_IsFrameUnchanged(ImDrawData* draw_data);
+IMGUI_IMPL_API const ImGui_ImplVulkan_FrameHashStats* ImGui_ImplVulkan_GetFrameHashStats();
+
+// (Advanced) Device memory owned by the backend. Buffers and textures are sub-allocated from shared blocks
+// (IMGUI_IMPL_VULKAN_MEMORY_BLOCK_SIZE, 16 MB by default); requests larger than half a block get their own VkDeviceMemory.
+struct ImGui_ImplVulkan_MemoryStats
+{
+    int                 BlockCount;
+    int                 DedicatedCount;         // Allocations too large for a block
+    int                 AllocationCount;        // Live allocations inside blocks
+    ImU64               BlockBytes;             // Device memory held by blocks
+    ImU64               DedicatedBytes;
+    ImU64               UsedBytes;              // Block memory handed out, rounded up to power-of-two nodes
+    ImU64               RequestedBytes;         // Block memory asked for. UsedBytes - RequestedBytes is lost to rounding.
+    ImU64               LargestFreeNode;        // Largest request that fits without a new block
+};
+IMGUI_IMPL_API void         ImGui_ImplVulkan_GetMemoryStats(ImGui_ImplVulkan_MemoryStats* out_stats);
+// (Advanced) Release idle staging buffers and empty blocks. Returns the number of block bytes given back to the driver.
+// Call e.g. after closing viewports or removing many textures. Live allocations are not moved.
+IMGUI_IMPL_API VkDeviceSize ImGui_ImplVulkan_CompactMemory();
+
 // Register a texture (VkDescriptorSet == ImTextureID)
 // FIXME: This is experimental in the sense that we are unsure how to best design/tackle this problem
 // Please post to https://github.com/ocornut/imgui/pull/914 if you have suggestions.
@@ -214,6 +302,7 @@ struct ImGui_ImplVulkanH_Frame
 {
     VkCommandPool       CommandPool;
     VkCommandBuffer     CommandBuffer;
+    VkCommandBuffer     SecondaryCommandBuffer;     // Secondary viewports with ImGui_ImplVulkan_InitInfo::ParallelForFn
     VkFence             Fence;
     VkImage             Backbuffer;
     VkImageView         BackbufferView;
@@ -0,0 +1,8 @@
+#!/bin/bash
+## -V: create SPIR-V binary
+## -x: save binary output as text-based 32-bit hexadecimal numbers
+## -o: output file
+set -e
+glslangValidator -V -x -o glsl_shader_bindless.frag.u32 glsl_shader_bindless.frag
+glslangValidator -V -o glsl_shader_bindless.frag.spv glsl_shader_bindless.frag
+spirv-val glsl_shader_bindless.frag.spv
@@ -0,0 +1,10 @@
+#version 450 core
+layout(constant_id = 0) const uint kMaxTextures = 1024; // Set to IMGUI_IMPL_VULKAN_BINDLESS_MAX_TEXTURES at pipeline creation
+layout(location = 0) out vec4 fColor;
+layout(set=0, binding=0) uniform sampler2D sTextures[kMaxTextures];
+layout(push_constant) uniform uPushConstant { layout(offset = 16) uint uTextureIndex; } pc;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+void main()
+{
+    fColor = In.Color * texture(sTextures[pc.uTextureIndex], In.UV.st);
+}
@@ -20,11 +20,19 @@
 #ifndef SML_UI_H
 #define SML_UI_H
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "imgui.h"
 #include "sml_parser.h"
+#include "sml_ui_binding.h"
+#include "sml_ui_diagnostics.h"
+#include "sml_ui_events.h"
+#include "sml_ui_tree.h"
 
 namespace smlui {
 
@@ -88,7 +96,14 @@ struct UiWindow {
         bool docking = false;
         std::string last_file_path_value;
         std::string theme;
+        // Frame pacing for the host swapchain, see UiFramePacer.
+        // "throughput" (FIFO) or "latency" (mailbox/immediate).
+        std::string present_mode = "throughput";
+        int frames_in_flight = 0;   // 0 picks the present mode's default
     } state;
+    // Every parsed element, including nested widgets the fields above do
+    // not describe. The fields stay the fast path for Window/DockLayout.
+    UiNodeTree tree;
 };
 
 struct UiTheme {
@@ -100,11 +115,92 @@ struct UiTheme {
     ImVec4 center_bg = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
 };
 
+// Enum values registered with the SML parser. A schema is immutable once
+// built; the built-in one is created on first use and shared by every
+// UiDocument. Applications extend it with withEnumValues(), which returns
+// a new schema and leaves the original untouched.
+class UiSchema {
+public:
+    struct EnumValue {
+        std::string property;
+        std::string value;
+    };
+
+    static std::shared_ptr<const UiSchema> builtin();
+    std::shared_ptr<const UiSchema> withEnumValues(const std::vector<EnumValue>& values) const;
+    bool hasEnumValue(const std::string& property, const std::string& value) const;
+    const std::vector<EnumValue>& enumValues() const { return enum_values_; }
+    void attach(sml::SmlSaxParser& parser) const;
+
+private:
+    std::vector<EnumValue> enum_values_;
+};
+
+// Rows for a ListView element. The view only asks for the rows that are
+// visible, so count() may be in the millions; draw_row() submits the ImGui
+// items of one row and is called with the row's ImGui ID pushed.
+struct UiListSource {
+    using CountCallback = size_t(*)(void* user_data);
+    using RowCallback = void(*)(size_t row, void* user_data);
+    CountCallback count = nullptr;
+    RowCallback draw_row = nullptr;
+    void* user_data = nullptr;
+};
+
+struct UiRect {
+    ImVec2 pos = ImVec2(0.0f, 0.0f);
+    ImVec2 size = ImVec2(0.0f, 0.0f);
+};
+
+// Screen rects of the dock panels for a viewport. Hidden panels have a
+// zero size. Without a DockLayout only center is set, to the work area.
+struct UiDockGeometry {
+    bool dock_enabled = false;
+    UiRect top;
+    UiRect bottom;
+    UiRect left;
+    UiRect right;
+    UiRect center;
+};
+
+struct UiFrameStats {
+    uint64_t rendered_frames = 0;
+    uint64_t skipped_frames = 0;
+};
+
 class UiDocument {
 public:
+    UiDocument();
+    // Schema used by subsequent parseFromString() calls; defaults to UiSchema::builtin().
+    void setSchema(std::shared_ptr<const UiSchema> schema);
+    std::shared_ptr<const UiSchema> schema() const { return std::atomic_load(&schema_); }
+    // Builds a new window from `text` alone and publishes it; menus, tools
+    // and tree nodes of the previous model are not carried over.
     bool parseFromString(const std::string& text, std::string* error_message);
-    const UiWindow& window() const { return window_; }
-    void setTheme(const UiTheme& theme) { theme_ = theme; }
+    // Precompiled layouts (.smlb), see sml_ui_compiled.cpp for the format.
+    bool saveCompiled(const std::string& path, std::string* error_message) const;
+    bool loadCompiled(const std::string& path, std::string* error_message);
+    bool loadCompiledFromMemory(const void* data, size_t size, std::string* error_message);
+    // Warnings and errors from parseFromString() are queued here instead of
+    // being printed. Drain them after a parse; attach a UiDiagnosticsWriter
+    // to also get console output from a background thread.
+    size_t drainDiagnostics(std::vector<UiDiagnostic>* out) { return diagnostics_.drain(out); }
+    void postDiagnostics(std::vector<UiDiagnostic> batch);
+    void setDiagnosticsWriter(UiDiagnosticsWriter* writer) { diagnostics_writer_.store(writer); }
+    UiDiagnosticCounters diagnosticCounters() const;
+    // The model is an immutable snapshot. publish() swaps it atomically, so
+    // another thread may replace it while render() keeps drawing the
+    // snapshot it loaded at the start of the frame. Labels and flags that
+    // render() needs are derived here, on the publishing thread. Hold the
+    // returned pointer for as long as the window is read; it stays valid
+    // after a later publish().
+    std::shared_ptr<const UiWindow> snapshot() const;
+    // Deprecated, use snapshot(). The reference is only valid until the next
+    // publish() or parse, so it must not be used while another thread (e.g.
+    // a UiLayoutWatcher) may publish.
+    const UiWindow& window() const;
+    void publish(std::shared_ptr<const UiWindow> window);
+    void setTheme(const UiTheme& theme);
     using PropertyPanelCallback = void(*)(const ImVec2& panel_pos, const ImVec2& panel_size, void* user_data);
     void setPropertyPanelCallback(PropertyPanelCallback callback, void* user_data) {
         property_panel_callback_ = callback;
@@ -115,15 +211,95 @@ public:
         menu_action_callback_ = callback;
         menu_action_user_data_ = user_data;
     }
+    // With deferred actions, render() queues menu/button actions and play
+    // clicks as UiEvents instead of calling the menu action callback while
+    // ImGui is mid-frame. After ImGui::Render() the host either drains them
+    // or calls dispatchEvents(), which runs the callback for each queued
+    // action. out_play_clicked is set in both modes.
+    void setDeferredActions(bool deferred) { deferred_actions_.store(deferred); }
+    size_t drainEvents(std::vector<UiEvent>* out, bool coalesce = false) { return events_.drain(out, coalesce); }
+    size_t dispatchEvents(bool coalesce = false);
+    // Binds `ListView { source: "name" }` to a data source. Passing a source
+    // without callbacks removes the binding.
+    void setListSource(const std::string& name, const UiListSource& source);
+    // Values for string properties written as "bind(path)", e.g.
+    // `Label { text: "bind(player.hp)" }`. render() calls bindings->update()
+    // and reads the current values; unbound paths draw as empty text. The
+    // document does not own the bindings; pass nullptr to detach.
+    void setBindings(UiBindings* bindings);
     void render(const ImGuiViewport* viewport, ImFont* font_15, bool* out_play_clicked) const;
+    // Panel rects render() uses for this viewport, e.g. to size a 3D render
+    // target to the center panel. Cached until the work area or the model
+    // changes; call on the render thread.
+    UiDockGeometry dockGeometry(const ImGuiViewport* viewport) const;
+
+    // Idle frame skipping. After polling events (e.g. glfwWaitEventsTimeout)
+    // the host asks needsRedraw(); when it returns false it may skip
+    // NewFrame/render/Render/present and call skipFrame() instead.
+    // A redraw is needed while the model or theme changed since the last
+    // rendered frame, input events are queued in the current ImGui context,
+    // hover/active state changed or an item is still active, a bound value
+    // changed, or a redraw was requested. requestRedraw() may be called from any thread.
+    bool needsRedraw() const;
+    void requestRedraw(int frames = 1);
+    void skipFrame() { ++skipped_frames_; }
+    UiFrameStats frameStats() const;
 
 private:
-    UiWindow window_;
+    struct RenderModel;
+    struct ThemeColors {
+        ImU32 toolbar_bg = 0;
+        ImU32 status_bg = 0;
+        ImU32 status_text = 0;
+        ImU32 left_bg = 0;
+        ImU32 right_bg = 0;
+        ImU32 center_bg = 0;
+    };
+
+    static std::shared_ptr<const RenderModel> buildRenderModel(std::shared_ptr<const UiWindow> window);
+    const UiDockGeometry& geometryFor(const std::shared_ptr<const RenderModel>& model, const ImGuiViewport* viewport) const;
+    void renderModel(const RenderModel& model, const UiDockGeometry& geometry, const ImGuiViewport* viewport, ImFont* font_15, bool* out_play_clicked) const;
+    void renderNodes(const RenderModel& model, UiNodeTree::Index first, ImFont* font_15, bool same_line) const;
+    const char* propertyString(const RenderModel& model, UiNodeTree::Index node, uint8_t property, const char* fallback) const;
+    void renderListView(const UiNodeTree& tree, UiNodeTree::Index node) const;
+    void trackFrame(uint64_t rendered_version) const;
+    void emitAction(UiEventType type, UiEventSource source, int action_id, UiNodeTree::Index node) const;
+
+    std::shared_ptr<const RenderModel> model_;
+    std::shared_ptr<const UiSchema> schema_;
+    UiDiagnosticQueue diagnostics_;
+    std::atomic<UiDiagnosticsWriter*> diagnostics_writer_{nullptr};
+    std::atomic<uint64_t> warning_count_{0};
+    std::atomic<uint64_t> error_count_{0};
     UiTheme theme_;
+    ThemeColors theme_colors_;
     PropertyPanelCallback property_panel_callback_ = nullptr;
     void* property_panel_user_data_ = nullptr;
+    std::vector<std::pair<std::string, UiListSource>> list_sources_;
     MenuActionCallback menu_action_callback_ = nullptr;
     void* menu_action_user_data_ = nullptr;
+    std::atomic<bool> deferred_actions_{false};
+    mutable UiEventQueue events_;
+    UiBindings* bindings_ = nullptr;
+    uint64_t bindings_generation_ = 0;      // bumped by setBindings(), 0 until the first call
+
+    // Frames to draw after a change so ImGui can settle auto-sized windows.
+    static const int kSettleFrames = 2;
+    std::atomic<uint64_t> model_version_{1};
+    mutable std::atomic<int> redraw_frames_{kSettleFrames};
+    mutable uint64_t rendered_version_ = 0;
+    mutable uint64_t rendered_binding_changes_ = 0;
+    mutable ImGuiID last_hovered_id_ = 0;
+    mutable ImGuiID last_active_id_ = 0;
+    mutable bool interaction_changed_ = false;
+    mutable std::atomic<uint64_t> rendered_frames_{0};
+    std::atomic<uint64_t> skipped_frames_{0};
+
+    // Last geometry computed by geometryFor() and what it was computed for.
+    mutable UiDockGeometry geometry_;
+    mutable std::shared_ptr<const RenderModel> geometry_model_;
+    mutable ImVec2 geometry_work_pos_;
+    mutable ImVec2 geometry_work_size_;
 };
 
 } // namespace smlui
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_BINDING_H
+#define SML_UI_BINDING_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace smlui {
+
+// Application values that SML properties bind to, e.g.
+//
+//   Label { text: "bind(player.hp)" }
+//
+// Every path is interned to a Key once. Plain values are set by the
+// application; derived values are computed from other keys and only
+// re-evaluated by update() when one of their inputs changed, in
+// dependency order. A frame with no changes costs one empty check.
+//
+// Not thread-safe: set values and call update() on the UI thread, e.g.
+// between polling events and rendering. changeCount() may be read from
+// any thread.
+class UiBindings {
+public:
+    typedef uint32_t Key;
+    static const Key kInvalid = 0xffffffffu;
+
+    using ComputeCallback = void(*)(const UiBindings& bindings, const Key* inputs, size_t input_count,
+                                    std::string* out, void* user_data);
+
+    Key key(const std::string& path);
+    Key find(const std::string& path) const;
+
+    // Returns true when the value changed. Derived keys cannot be set.
+    bool set(Key key, const std::string& value);
+    bool set(Key key, int value);
+    bool set(const std::string& path, const std::string& value) { return set(key(path), value); }
+    bool set(const std::string& path, int value) { return set(key(path), value); }
+
+    // Defines path as computed from inputs. Fails with kInvalid if path is
+    // already derived or already an input of something, which keeps the
+    // dependency graph acyclic.
+    Key define(const std::string& path, const std::vector<std::string>& inputs, ComputeCallback compute, void* user_data);
+
+    // Unknown keys, including kInvalid, read as "" with version 0.
+    const std::string& value(Key key) const;
+    const std::string& value(const std::string& path) const;
+    // Bumped on every change of this key.
+    uint64_t version(Key key) const { return key < versions_.size() ? versions_[key] : 0; }
+
+    // Re-evaluates dirty derived values; returns how many were computed.
+    size_t update();
+    bool dirty() const { return !dirty_.empty(); }
+    uint64_t changeCount() const { return change_count_.load(); }
+    size_t size() const { return values_.size(); }
+
+private:
+    struct Derived {
+        std::vector<Key> inputs;
+        ComputeCallback compute = nullptr;
+        void* user_data = nullptr;
+    };
+
+    bool store(Key key, std::string value);
+    void markDependents(Key key);
+
+    std::unordered_map<std::string, Key> keys_;
+    std::vector<std::string> values_;
+    std::vector<uint64_t> versions_;
+    std::vector<uint32_t> levels_;          // 0 for plain values, 1 + max(input levels) otherwise
+    std::vector<int32_t> derived_index_;    // into derived_, -1 for plain values
+    std::vector<std::vector<Key>> dependents_;
+    std::vector<uint8_t> dirty_flags_;
+    std::vector<Derived> derived_;
+    std::vector<Key> dirty_;
+    std::atomic<uint64_t> change_count_{0};
+};
+
+} // namespace smlui
+
+#endif
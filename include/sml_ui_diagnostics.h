@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_DIAGNOSTICS_H
+#define SML_UI_DIAGNOSTICS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace smlui {
+
+enum class UiSeverity : uint8_t {
+    Info,
+    Warning,
+    Error
+};
+
+enum class UiDiagnosticCode : uint8_t {
+    UnknownElement,
+    UnknownProperty,
+    ParseError
+};
+
+const char* UiSeverityText(UiSeverity severity);
+const char* UiDiagnosticCodeText(UiDiagnosticCode code);
+
+struct UiDiagnostic {
+    UiSeverity severity = UiSeverity::Warning;
+    UiDiagnosticCode code = UiDiagnosticCode::UnknownElement;
+    std::string detail;   // "Bogus", "Window.foo", parser message
+    std::string source;   // file path when known
+    int line = 0;         // 1-based position of the first occurrence, 0 if unknown
+    int column = 0;
+    uint32_t count = 1;   // occurrences folded into this entry
+};
+
+// "UI Warning: Unknown property -> Window.foo (layout.sml:12:5, 3x)"
+std::string FormatDiagnostic(const UiDiagnostic& diagnostic);
+
+struct UiDiagnosticCounters {
+    uint64_t warnings = 0;
+    uint64_t errors = 0;
+};
+
+// Multi-producer queue of diagnostic batches. push() is a single CAS on a
+// linked list; drain() detaches the whole list at once and returns the
+// batches in push order.
+class UiDiagnosticQueue {
+public:
+    UiDiagnosticQueue() {}
+    ~UiDiagnosticQueue();
+
+    void push(std::vector<UiDiagnostic> batch);
+    size_t drain(std::vector<UiDiagnostic>* out);
+    bool empty() const { return head_.load() == nullptr; }
+
+private:
+    UiDiagnosticQueue(const UiDiagnosticQueue&);
+    UiDiagnosticQueue& operator=(const UiDiagnosticQueue&);
+
+    struct Node {
+        std::vector<UiDiagnostic> batch;
+        Node* next;
+    };
+    std::atomic<Node*> head_{nullptr};
+};
+
+// Optional console output on its own thread, so parsing threads never
+// block on stream I/O. Output is flushed once per drained batch.
+class UiDiagnosticsWriter {
+public:
+    explicit UiDiagnosticsWriter(FILE* stream = stderr);
+    ~UiDiagnosticsWriter();
+
+    void post(const std::vector<UiDiagnostic>& batch);
+
+private:
+    UiDiagnosticsWriter(const UiDiagnosticsWriter&);
+    UiDiagnosticsWriter& operator=(const UiDiagnosticsWriter&);
+
+    void run();
+    void write(const std::vector<UiDiagnostic>& batch);
+
+    FILE* stream_;
+    UiDiagnosticQueue queue_;
+    std::atomic<bool> stop_requested_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::thread worker_;
+};
+
+} // namespace smlui
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_EVENTS_H
+#define SML_UI_EVENTS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "sml_ui_tree.h"
+
+namespace smlui {
+
+enum class UiEventType : uint8_t {
+    Action,     // menu item or button with an action id
+    Play        // play tool in the toolbar
+};
+
+enum class UiEventSource : uint8_t {
+    MenuItem,
+    Button,
+    ToolButton
+};
+
+struct UiEvent {
+    UiEventType type = UiEventType::Action;
+    UiEventSource source = UiEventSource::MenuItem;
+    int action_id = 0;
+    UiNodeTree::Index node = UiNodeTree::kNone;   // element in UiWindow::tree, when known
+    uint64_t frame = 0;                           // rendered frame that produced the event
+    std::chrono::steady_clock::time_point time;
+    uint32_t count = 1;                           // events folded into this one by coalescing
+};
+
+// Multi-producer queue of UI events, same scheme as UiDiagnosticQueue:
+// push() is a single CAS, drain() detaches everything at once and returns
+// events in push order. With coalesce, repeats of the same type and
+// action id are folded into their first occurrence.
+class UiEventQueue {
+public:
+    UiEventQueue() {}
+    ~UiEventQueue();
+
+    void push(const UiEvent& event);
+    size_t drain(std::vector<UiEvent>* out, bool coalesce = false);
+    bool empty() const { return head_.load() == nullptr; }
+
+private:
+    UiEventQueue(const UiEventQueue&);
+    UiEventQueue& operator=(const UiEventQueue&);
+
+    struct Node {
+        UiEvent event;
+        Node* next;
+    };
+    std::atomic<Node*> head_{nullptr};
+};
+
+} // namespace smlui
+
+#endif
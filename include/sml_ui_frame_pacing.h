@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_FRAME_PACING_H
+#define SML_UI_FRAME_PACING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "sml_ui.h"
+
+namespace smlui {
+
+enum class UiPresentMode : uint8_t {
+    Throughput,     // FIFO, two frames in flight: never tears, keeps the GPU busy
+    Latency         // mailbox or immediate, one frame in flight: input is sampled as late as possible
+};
+
+// Input-to-submit latency over the last kLatencyWindow frames that
+// carried input.
+struct UiLatencyStats {
+    uint64_t samples = 0;   // frames with input since configure()
+    double last_ms = 0.0;
+    double p50_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+};
+
+// Present mode, swapchain size and frames in flight for a host that drives
+// its main window with the ImGui_ImplVulkanH_Window helpers, configured
+// from the SML state block:
+//
+//   Window { state { presentMode: latency framesInFlight: 1 } }
+//
+// ImGui_ImplVulkanH ties frames in flight to the swapchain image count;
+// waitForFrameSlot() caps them independently by waiting on the fences of
+// earlier submissions. Per frame:
+//
+//   pacer.waitForFrameSlot(device);      // before polling input
+//   glfwPollEvents();
+//   pacer.beginFrame();
+//   ImGui::NewFrame(); ... ImGui::Render();
+//   // FrameRender(): acquire, record, vkQueueSubmit(..., fd->Fence)
+//   pacer.frameSubmitted(fd->Fence);
+//   // FramePresent()
+class UiFramePacer {
+public:
+    static const int kMaxFramesInFlight = 8;
+    static const int kLatencyWindow = 256;
+
+    UiFramePacer() {}
+
+    // Unknown present modes fall back to throughput; framesInFlight 0
+    // picks the mode's default, other values are clamped to
+    // [1, kMaxFramesInFlight]. Resets the latency statistics.
+    void configure(const UiWindow::UiState& state);
+    void configure(UiPresentMode mode, int frames_in_flight = 0);
+
+    UiPresentMode mode() const { return mode_; }
+    int framesInFlight() const { return frames_in_flight_; }
+
+    // Preferred present modes, best first, for ImGui_ImplVulkanH_SelectPresentMode().
+    const VkPresentModeKHR* presentModes(int* count) const;
+    // Swapchain image count for the present mode the surface accepted.
+    uint32_t minImageCount(VkPresentModeKHR present_mode) const;
+
+    // Blocks until fewer than framesInFlight() submitted frames are still
+    // on the GPU.
+    void waitForFrameSlot(VkDevice device);
+    // Call right after vkQueueSubmit() with the fence it signals. Ends the
+    // latency measurement of the frame.
+    void frameSubmitted(VkFence fence);
+    // Forgets pending fences, e.g. after vkDeviceWaitIdle() or a swapchain rebuild.
+    void clearPending() { pending_.clear(); }
+
+    // Input timestamps. inputReceived() may be called from any thread, e.g.
+    // in chained GLFW callbacks; the earliest call since the last submit
+    // counts. Without it, beginFrame() stamps frames whose ImGui input
+    // queue is not empty, which misses the time spent before polling.
+    void inputReceived();
+    void beginFrame();
+
+    UiLatencyStats latency() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    UiPresentMode mode_ = UiPresentMode::Throughput;
+    int frames_in_flight_ = 2;
+    std::vector<VkFence> pending_;
+    std::atomic<int64_t> input_ns_{0};      // Clock ticks since epoch in ns, 0 if no input pending
+    std::vector<double> samples_ms_;        // ring of kLatencyWindow samples
+    uint64_t sample_count_ = 0;
+    double last_ms_ = 0.0;
+    double max_ms_ = 0.0;
+};
+
+} // namespace smlui
+
+#endif
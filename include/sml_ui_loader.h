@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_LOADER_H
+#define SML_UI_LOADER_H
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sml_ui.h"
+
+namespace smlui {
+
+struct UiLoadResult {
+    std::string path;
+    bool ok = false;
+    std::string error_message;
+    std::vector<UiDiagnostic> diagnostics;  // parse warnings, source set to path
+    std::shared_ptr<UiDocument> document;
+};
+
+// Parses many layout files in parallel on a work-stealing thread pool.
+// Every file gets its own UiDocument; all of them share the loader's
+// schema. Files ending in ".smlb" are loaded with loadCompiled().
+class UiDocumentLoader {
+public:
+    // thread_count 0 uses std::thread::hardware_concurrency().
+    explicit UiDocumentLoader(unsigned thread_count = 0);
+    ~UiDocumentLoader();
+
+    void setSchema(std::shared_ptr<const UiSchema> schema);
+    unsigned threadCount() const;
+
+    std::vector<std::future<UiLoadResult>> loadAsync(const std::vector<std::string>& paths);
+
+    // Called on a worker thread as each file finishes, in completion order.
+    using CompletionCallback = void(*)(const UiLoadResult& result, void* user_data);
+    void loadAsync(const std::vector<std::string>& paths, CompletionCallback callback, void* user_data);
+
+    // Blocks until every file is loaded; results keep the order of paths.
+    std::vector<UiLoadResult> loadAll(const std::vector<std::string>& paths, size_t* out_failed = nullptr);
+
+    // Blocks until all queued work, including loadAsync() callbacks, is done.
+    void wait();
+
+private:
+    UiDocumentLoader(const UiDocumentLoader&);
+    UiDocumentLoader& operator=(const UiDocumentLoader&);
+
+    class Pool;
+    std::unique_ptr<Pool> pool_;
+    std::shared_ptr<const UiSchema> schema_;
+};
+
+} // namespace smlui
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_PIPELINE_CACHE_H
+#define SML_UI_PIPELINE_CACHE_H
+
+#include <chrono>
+#include <string>
+
+#include <vulkan/vulkan.h>
+
+namespace smlui {
+
+struct UiPipelineCacheStats {
+    bool warm = false;             // load() accepted the file on disk
+    std::string rejected;          // why an existing file was ignored, empty otherwise
+    size_t loaded_bytes = 0;
+    size_t saved_bytes = 0;
+    double create_ms = 0.0;        // pipeline creation time measured in this run
+    double cold_create_ms = 0.0;   // creation time of the run that first wrote the file, 0 if unknown
+    double saved_ms = 0.0;         // cold_create_ms - create_ms on warm starts
+};
+
+// Keeps a VkPipelineCache in a file between runs. The file is only used
+// when vendor ID, device ID, driver version and pipeline cache UUID match
+// the current device; otherwise the cache starts empty and save()
+// replaces the file. Pass handle() as ImGui_ImplVulkan_InitInfo::PipelineCache
+// and wrap the pipeline creation (ImGui_ImplVulkan_Init()) in
+// beginCreation()/endCreation() to get the time saved on warm starts:
+//
+//   cache.load(physical_device, device, "smlui.pipeline_cache");
+//   init_info.PipelineCache = cache.handle();
+//   cache.beginCreation();
+//   ImGui_ImplVulkan_Init(&init_info);
+//   cache.endCreation();
+//   ...
+//   ImGui_ImplVulkan_Shutdown();
+//   cache.save();
+//   cache.destroy();
+class UiPipelineCache {
+public:
+    UiPipelineCache() {}
+    ~UiPipelineCache();
+
+    // Creates the cache, seeded from path when the file is valid for this
+    // device. Returns false only if no cache could be created at all.
+    bool load(VkPhysicalDevice physical_device, VkDevice device, const std::string& path,
+              const VkAllocationCallbacks* allocator = nullptr, std::string* error_message = nullptr);
+    // Writes the cache data to path + ".tmp" and renames it over path.
+    bool save(std::string* error_message = nullptr);
+    void destroy();
+
+    VkPipelineCache handle() const { return cache_; }
+
+    // Time spent between the calls is added to stats().create_ms.
+    void beginCreation();
+    void endCreation();
+
+    const UiPipelineCacheStats& stats() const { return stats_; }
+
+private:
+    UiPipelineCache(const UiPipelineCache&);
+    UiPipelineCache& operator=(const UiPipelineCache&);
+
+    VkDevice device_ = VK_NULL_HANDLE;
+    VkPipelineCache cache_ = VK_NULL_HANDLE;
+    const VkAllocationCallbacks* allocator_ = nullptr;
+    VkPhysicalDeviceProperties properties_ = {};
+    std::string path_;
+    std::chrono::steady_clock::time_point creation_start_;
+    UiPipelineCacheStats stats_;
+};
+
+} // namespace smlui
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_RELOAD_H
+#define SML_UI_RELOAD_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "sml_ui.h"
+
+namespace smlui {
+
+// Watches one .sml file and hot-reloads it into a UiDocument.
+// Changes are picked up with inotify on Linux (stat polling elsewhere),
+// re-parsed on a worker thread into a fresh UiWindow and handed over with
+// UiDocument::publish(). A failed parse keeps the previous model.
+class UiLayoutWatcher {
+public:
+    UiLayoutWatcher() {}
+    ~UiLayoutWatcher() { stop(); }
+
+    // Called on the worker thread after every reload attempt.
+    using ReloadCallback = void(*)(bool ok, const std::string& error_message, void* user_data);
+    void setReloadCallback(ReloadCallback callback, void* user_data) {
+        reload_callback_ = callback;
+        reload_user_data_ = user_data;
+    }
+
+    // document must outlive the watcher or the next stop().
+    bool watch(UiDocument* document, const std::string& path, std::string* error_message);
+    void stop();
+    bool running() const { return worker_.joinable(); }
+    unsigned reloadCount() const { return reload_count_.load(); }
+    unsigned failedReloadCount() const { return failed_reload_count_.load(); }
+
+private:
+    UiLayoutWatcher(const UiLayoutWatcher&);
+    UiLayoutWatcher& operator=(const UiLayoutWatcher&);
+
+    void run();
+    void reload();
+
+    UiDocument* document_ = nullptr;
+    std::string path_;
+    std::string directory_;
+    std::string file_name_;
+    std::thread worker_;
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<unsigned> reload_count_{0};
+    std::atomic<unsigned> failed_reload_count_{0};
+    int notify_fd_ = -1;
+    int wake_fd_[2] = {-1, -1};
+    ReloadCallback reload_callback_ = nullptr;
+    void* reload_user_data_ = nullptr;
+};
+
+} // namespace smlui
+
+#endif
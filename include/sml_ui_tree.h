@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_TREE_H
+#define SML_UI_TREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sml_parser.h"
+
+namespace smlui {
+
+// Retained tree of every element in a layout. Nodes live in parallel arrays
+// indexed by creation order, which for SAX input is pre-order: a node's
+// subtree follows it directly, so a depth-first walk reads each array front
+// to back. Top-level elements are roots linked as siblings, starting at 0.
+//
+// Node types and property ids are the ElementId/PropertyId values from
+// sml_ui_symbols.h. Unknown elements are kept (type 0) so the structure
+// below them survives; unknown properties are not stored.
+//
+// The tree is append-only. After adding nodes and properties call
+// finalize() once; it groups properties by node so that each node owns a
+// contiguous range.
+class UiNodeTree {
+public:
+    typedef uint32_t Index;
+    static const Index kNone = 0xffffffffu;
+
+    struct Property {
+        uint8_t id;     // PropertyId
+        uint8_t kind;   // sml::PropertyValue::Type
+        int32_t x;      // Int, Boolean, Vec2i x; string offset
+        int32_t y;      // Vec2i y; string length
+    };
+
+    Index addNode(Index parent, uint8_t type);
+    void addProperty(Index node, uint8_t id, const sml::PropertyValue& value);
+    void finalize();
+
+    size_t size() const { return types_.size(); }
+    bool empty() const { return types_.empty(); }
+    Index root() const { return types_.empty() ? kNone : 0; }
+    uint8_t type(Index node) const { return types_[node]; }
+    Index parent(Index node) const { return parents_[node]; }
+    Index firstChild(Index node) const { return first_children_[node]; }
+    Index nextSibling(Index node) const { return next_siblings_[node]; }
+
+    const Property* properties(Index node, size_t* count) const;
+    const Property* findProperty(Index node, uint8_t id) const;
+    static bool isString(const Property& property);
+    // NUL-terminated; valid until the tree is modified.
+    const char* string(const Property& property) const { return strings_.data() + property.x; }
+    const char* stringOr(Index node, uint8_t id, const char* fallback) const;
+    int intOr(Index node, uint8_t id, int fallback) const;
+
+    // Bytes held by the arrays, for budgeting large layouts.
+    size_t memoryUsage() const;
+
+private:
+    std::vector<uint8_t> types_;
+    std::vector<Index> parents_;
+    std::vector<Index> first_children_;
+    std::vector<Index> next_siblings_;
+    std::vector<Index> last_children_;
+    std::vector<uint32_t> first_properties_;
+    std::vector<uint32_t> property_counts_;
+    std::vector<Property> properties_;
+    std::vector<Index> property_nodes_;
+    std::string strings_;
+    Index last_root_ = kNone;
+    bool sorted_ = true;
+};
+
+} // namespace smlui
+
+#endif
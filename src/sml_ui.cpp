@@ -18,12 +18,15 @@
  */
 
 #include "sml_ui.h"
+#include "sml_ui_symbols.h"
+#include "imgui_internal.h"
 
 #include <vector>
 #include <cctype>
+#include <cstring>
+#include <climits>
 #include <algorithm>
-#include <iostream>
-#include <set>
+#include <unordered_map>
 
 namespace smlui {
 
@@ -71,236 +74,862 @@ static int MenuActionIdFor(const std::string& action) {
     return 0;
 }
 
+// Best-effort source positions for diagnostics. SAX events arrive in
+// document order and every element opens with '{' and every property with
+// ':', so advance() only counts events; the text is scanned when a warning
+// asks for the position of the latest one, from where the previous scan
+// stopped, skipping strings and comments.
+class SourceLocator {
+public:
+    explicit SourceLocator(const std::string* text) : text_(text) {}
+
+    void advance(const std::string& name) {
+        if (!text_ || name.empty())
+            return;
+        ++pending_;
+        pending_name_size_ = name.size();
+    }
+
+    int line() {
+        resolve();
+        return text_ ? line_ : 0;
+    }
+
+    int column() {
+        resolve();
+        return text_ ? column_ : 0;
+    }
+
+private:
+    void resolve() {
+        if (!text_ || pending_ == 0)
+            return;
+        const std::string& text = *text_;
+        size_t pos = cursor_;
+        for (; pos < text.size(); ++pos) {
+            char c = text[pos];
+            if (c == '\n') {
+                newLine(pos);
+            } else if (c == '"') {
+                for (++pos; pos < text.size() && text[pos] != '"'; ++pos) {
+                    if (text[pos] == '\\')
+                        ++pos;
+                    else if (text[pos] == '\n')
+                        newLine(pos);
+                }
+            } else if (c == '/' && pos + 1 < text.size() && text[pos + 1] == '/') {
+                while (pos + 1 < text.size() && text[pos + 1] != '\n')
+                    ++pos;
+            } else if (c == '/' && pos + 1 < text.size() && text[pos + 1] == '*') {
+                for (pos += 2; pos + 1 < text.size() && !(text[pos] == '*' && text[pos + 1] == '/'); ++pos) {
+                    if (text[pos] == '\n')
+                        newLine(pos);
+                }
+                ++pos;
+            } else if ((c == '{' || c == ':') && --pending_ == 0) {
+                break;
+            }
+        }
+        if (pos >= text.size()) {
+            pending_ = 0;
+            cursor_ = text.size();
+            return;
+        }
+        // The name ends at the last non-blank character before the terminator.
+        size_t end = pos;
+        while (end > line_start_ && (text[end - 1] == ' ' || text[end - 1] == '\t'))
+            --end;
+        size_t start = end >= line_start_ + pending_name_size_ ? end - pending_name_size_ : line_start_;
+        column_ = (int)(start - line_start_) + 1;
+        cursor_ = pos + 1;
+    }
+
+    void newLine(size_t pos) {
+        ++line_;
+        line_start_ = pos + 1;
+    }
+
+    const std::string* text_;
+    size_t cursor_ = 0;
+    size_t line_start_ = 0;
+    size_t pending_ = 0;            // events since the last resolve()
+    size_t pending_name_size_ = 0;  // name length of the latest event
+    int line_ = 1;
+    int column_ = 0;
+};
+
 class UiSmlHandler : public sml::SmlHandler {
 public:
-    explicit UiSmlHandler(UiWindow* model) : model_(model) {}
+    UiSmlHandler(UiWindow* model, const std::string* source) : model_(model), locator_(source) {}
+
+    std::vector<UiDiagnostic> takeDiagnostics() { return std::move(diagnostics_); }
 
     void startElement(const std::string& name) override {
-        stack_.push_back(name);
+        locator_.advance(name);
+        ElementId element = LookupElement(name);
+        stack_.push_back(element);
+        if (element == ElementId::Unknown)
+            unknown_names_.push_back(name);
         if (!model_)
             return;
-        if (name == "MainMenu") {
+        nodes_.push_back(model_->tree.addNode(nodes_.empty() ? UiNodeTree::kNone : nodes_.back(), (uint8_t)element));
+        switch (element) {
+        case ElementId::MainMenu:
             model_->main_menu.enabled = true;
             in_main_menu_ = true;
-        } else if (name == "Menu" && in_main_menu_) {
-            model_->main_menu.menus.push_back(UiMenu());
-            current_menu_ = &model_->main_menu.menus.back();
-        } else if (name == "MenuItem" && current_menu_) {
-            current_menu_->items.push_back(UiMenuItem());
-            current_item_ = &current_menu_->items.back();
-        } else if (name == "Separator" && current_menu_) {
-            UiMenuItem item;
-            item.is_separator = true;
-            current_menu_->items.push_back(item);
-            current_item_ = nullptr;
-        } else if (name == "DockLayout") {
-            model_->dock.enabled = true;
-        } else if (name == "MenuBar") {
-            model_->dock.show_menubar = true;
-        } else if (name == "ToolBar") {
-            model_->dock.show_toolbar = true;
-        } else if (name == "StatusBar") {
-            model_->dock.show_statusbar = true;
-        } else if (name == "PropertyPanel") {
-            model_->dock.show_property_panel = true;
-        } else if (name == "Viewport3D") {
-            model_->dock.show_viewport = true;
-        } else if (name == "Overlay") {
-            model_->dock.show_overlay = true;
-        } else if (!isKnownElement(name)) {
-            warnOnce("Unknown element", name);
+            break;
+        case ElementId::Menu:
+            if (in_main_menu_) {
+                model_->main_menu.menus.push_back(UiMenu());
+                current_menu_ = &model_->main_menu.menus.back();
+            }
+            break;
+        case ElementId::MenuItem:
+            if (current_menu_) {
+                current_menu_->items.push_back(UiMenuItem());
+                current_item_ = &current_menu_->items.back();
+            }
+            break;
+        case ElementId::Separator:
+            if (current_menu_) {
+                UiMenuItem item;
+                item.is_separator = true;
+                current_menu_->items.push_back(item);
+                current_item_ = nullptr;
+            }
+            break;
+        case ElementId::DockLayout: model_->dock.enabled = true; break;
+        case ElementId::MenuBar: model_->dock.show_menubar = true; break;
+        case ElementId::ToolBar: model_->dock.show_toolbar = true; break;
+        case ElementId::StatusBar: model_->dock.show_statusbar = true; break;
+        case ElementId::PropertyPanel: model_->dock.show_property_panel = true; break;
+        case ElementId::Viewport3D: model_->dock.show_viewport = true; break;
+        case ElementId::Overlay: model_->dock.show_overlay = true; break;
+        case ElementId::Unknown: warnUnknownElement(name); break;
+        default: break;
         }
     }
 
     void onProperty(const std::string& name, const sml::PropertyValue& value) override {
+        locator_.advance(name);
         if (!model_ || stack_.empty())
             return;
-        const std::string& element = stack_.back();
+        const ElementId element = stack_.back();
+        const PropertyId property = LookupProperty(name);
         bool handled = true;
-        if (element == "Window") {
-            if (name == "title" && value.type == sml::PropertyValue::String)
+        switch (element) {
+        case ElementId::Window:
+            if (property == PropertyId::Title && value.type == sml::PropertyValue::String)
                 model_->title = value.string_value;
-            else if (name == "position" && value.type == sml::PropertyValue::Vec2iType)
+            else if (property == PropertyId::Position && value.type == sml::PropertyValue::Vec2iType)
                 model_->position = value.vec2i_value;
-            else if (name == "size" && value.type == sml::PropertyValue::Vec2iType)
+            else if (property == PropertyId::Size && value.type == sml::PropertyValue::Vec2iType)
                 model_->size = value.vec2i_value;
             else
                 handled = false;
-        } else if (element == "state") {
-            if (name == "persist" && value.type == sml::PropertyValue::EnumType)
+            break;
+        case ElementId::State:
+            if (property == PropertyId::Persist && value.type == sml::PropertyValue::EnumType)
                 model_->state.persist = value.string_value;
-            else if (name == "theme" && value.type == sml::PropertyValue::String)
+            else if (property == PropertyId::Theme && value.type == sml::PropertyValue::String)
                 model_->state.theme = value.string_value;
-            else if (name == "pos" && value.type == sml::PropertyValue::Boolean)
+            else if (property == PropertyId::Pos && value.type == sml::PropertyValue::Boolean)
                 model_->state.pos = value.bool_value;
-            else if (name == "size" && value.type == sml::PropertyValue::Boolean)
+            else if (property == PropertyId::Size && value.type == sml::PropertyValue::Boolean)
                 model_->state.size = value.bool_value;
-            else if (name == "maximized" && value.type == sml::PropertyValue::Boolean)
+            else if (property == PropertyId::Maximized && value.type == sml::PropertyValue::Boolean)
                 model_->state.maximized = value.bool_value;
-            else if (name == "lastFilePath" && value.type == sml::PropertyValue::Boolean)
+            else if (property == PropertyId::LastFilePath && value.type == sml::PropertyValue::Boolean)
                 model_->state.last_file_path = value.bool_value;
-            else if (name == "docking" && value.type == sml::PropertyValue::Boolean)
+            else if (property == PropertyId::Docking && value.type == sml::PropertyValue::Boolean)
                 model_->state.docking = value.bool_value;
+            else if (property == PropertyId::PresentMode && value.type == sml::PropertyValue::EnumType)
+                model_->state.present_mode = value.string_value;
+            else if (property == PropertyId::FramesInFlight && value.type == sml::PropertyValue::Int)
+                model_->state.frames_in_flight = value.int_value;
             else
                 handled = false;
-        } else if (element == "Label") {
-            if (name == "position" && value.type == sml::PropertyValue::Vec2iType)
+            break;
+        case ElementId::Label:
+            if (property == PropertyId::Position && value.type == sml::PropertyValue::Vec2iType)
                 model_->label.position = value.vec2i_value;
-            else if (name == "text" && value.type == sml::PropertyValue::String)
+            else if (property == PropertyId::Text && value.type == sml::PropertyValue::String)
                 model_->label.text = value.string_value;
-            else if (name == "fontSize" && value.type == sml::PropertyValue::Int)
+            else if (property == PropertyId::FontSize && value.type == sml::PropertyValue::Int)
                 model_->label.font_size = value.int_value;
             else
                 handled = false;
-        } else if (element == "Menu" && current_menu_) {
-            if (name == "label" && value.type == sml::PropertyValue::String)
+            break;
+        case ElementId::Menu:
+            if (!current_menu_) {
+                handled = onDockProperty(element, property, value);
+                break;
+            }
+            if (property == PropertyId::Label && value.type == sml::PropertyValue::String)
                 current_menu_->label = value.string_value;
             else
                 handled = false;
-        } else if (element == "MenuItem" && current_item_) {
-            if (name == "label" && value.type == sml::PropertyValue::String)
+            break;
+        case ElementId::Button:
+            // Stored in the node tree only; renderNodes() reads them back.
+            handled = (property == PropertyId::Label && value.type == sml::PropertyValue::String) ||
+                      (property == PropertyId::Action && (value.type == sml::PropertyValue::EnumType || value.type == sml::PropertyValue::String)) ||
+                      ((property == PropertyId::Width || property == PropertyId::Height) && value.type == sml::PropertyValue::Int);
+            break;
+        case ElementId::ListView:
+            handled = (property == PropertyId::Source && value.type == sml::PropertyValue::String) ||
+                      (property == PropertyId::Height && value.type == sml::PropertyValue::Int);
+            break;
+        case ElementId::MenuItem:
+            if (!current_item_) {
+                handled = onDockProperty(element, property, value);
+                break;
+            }
+            if (property == PropertyId::Label && value.type == sml::PropertyValue::String)
                 current_item_->label = value.string_value;
-            else if (name == "clicked" && (value.type == sml::PropertyValue::String || value.type == sml::PropertyValue::EnumType))
+            else if (property == PropertyId::Clicked && (value.type == sml::PropertyValue::String || value.type == sml::PropertyValue::EnumType))
                 current_item_->clicked = value.string_value;
-            else if (name == "action" && (value.type == sml::PropertyValue::EnumType || value.type == sml::PropertyValue::String)) {
+            else if (property == PropertyId::Action && (value.type == sml::PropertyValue::EnumType || value.type == sml::PropertyValue::String)) {
                 current_item_->action = value.string_value;
                 current_item_->action_id = MenuActionIdFor(value.string_value);
             }
-            else if (name == "useOnMac" && value.type == sml::PropertyValue::Boolean)
+            else if (property == PropertyId::UseOnMac && value.type == sml::PropertyValue::Boolean)
                 current_item_->use_on_mac = value.bool_value;
             else
                 handled = false;
-        } else if (name == "height" && value.type == sml::PropertyValue::Int) {
-            if (element == "Top" || element == "ToolBar")
+            break;
+        default:
+            handled = onDockProperty(element, property, value);
+            break;
+        }
+
+        if (handled)
+            model_->tree.addProperty(nodes_.back(), (uint8_t)property, value);
+        else
+            warnUnknownProperty(element, name);
+    }
+
+    void endElement(const std::string& name) override {
+        (void)name;
+        if (stack_.empty())
+            return;
+        switch (stack_.back()) {
+        case ElementId::MenuItem: current_item_ = nullptr; break;
+        case ElementId::Menu: current_menu_ = nullptr; break;
+        case ElementId::MainMenu: in_main_menu_ = false; break;
+        case ElementId::Unknown: unknown_names_.pop_back(); break;
+        default: break;
+        }
+        stack_.pop_back();
+        if (model_)
+            nodes_.pop_back();
+    }
+
+private:
+    // Dock slot properties shared by Top/Bottom/Left/Right/Center and the bars inside them.
+    bool onDockProperty(ElementId element, PropertyId property, const sml::PropertyValue& value) {
+        if (property == PropertyId::Height && value.type == sml::PropertyValue::Int) {
+            if (element == ElementId::Top || element == ElementId::ToolBar)
                 model_->dock.top_height = value.int_value;
-            else if (element == "Bottom" || element == "StatusBar")
+            else if (element == ElementId::Bottom || element == ElementId::StatusBar)
                 model_->dock.bottom_height = value.int_value;
             else
-                handled = false;
-        } else if ((element == "Left" || element == "Right") && name == "width" && value.type == sml::PropertyValue::Int) {
-            if (element == "Left")
+                return false;
+            return true;
+        }
+        if ((element == ElementId::Left || element == ElementId::Right) && property == PropertyId::Width &&
+            value.type == sml::PropertyValue::Int) {
+            if (element == ElementId::Left)
                 model_->dock.left_width = value.int_value;
             else
                 model_->dock.right_width = value.int_value;
-        } else if (name == "label" && value.type == sml::PropertyValue::String) {
-            if (element == "Left")
-                model_->dock.left_label = value.string_value;
-            else if (element == "Right")
-                model_->dock.right_label = value.string_value;
-            else if (element == "Center")
-                model_->dock.center_label = value.string_value;
-            else if (element == "Top")
-                model_->dock.top_label = value.string_value;
-            else if (element == "Bottom")
-                model_->dock.bottom_label = value.string_value;
-            else
-                handled = false;
-        } else if (element == "ToolButton" && name == "icon") {
-            std::string icon = value.string_value;
-            if (value.type == sml::PropertyValue::EnumType)
-                icon = value.string_value;
-            if (stack_.size() >= 2 && stack_[stack_.size() - 2] == "ToolBar")
-                model_->dock.toolbar_tools.push_back(icon);
-            else if (std::find(stack_.begin(), stack_.end(), "Left") != stack_.end())
-                model_->dock.left_tools.push_back(icon);
+            return true;
+        }
+        if (property == PropertyId::Label && value.type == sml::PropertyValue::String) {
+            switch (element) {
+            case ElementId::Left: model_->dock.left_label = value.string_value; return true;
+            case ElementId::Right: model_->dock.right_label = value.string_value; return true;
+            case ElementId::Center: model_->dock.center_label = value.string_value; return true;
+            case ElementId::Top: model_->dock.top_label = value.string_value; return true;
+            case ElementId::Bottom: model_->dock.bottom_label = value.string_value; return true;
+            default: return false;
+            }
+        }
+        if (element == ElementId::ToolButton && property == PropertyId::Icon) {
+            if (stack_.size() >= 2 && stack_[stack_.size() - 2] == ElementId::ToolBar)
+                model_->dock.toolbar_tools.push_back(value.string_value);
+            else if (std::find(stack_.begin(), stack_.end(), ElementId::Left) != stack_.end())
+                model_->dock.left_tools.push_back(value.string_value);
             else
-                handled = false;
-        } else {
-            handled = false;
+                return false;
+            return true;
         }
+        return false;
+    }
 
-        if (!handled) {
-            warnOnce("Unknown property", element + "." + name);
-        }
+    uint32_t intern(const std::string& name) {
+        std::unordered_map<std::string, uint32_t>::iterator it = names_.find(name);
+        if (it != names_.end())
+            return it->second;
+        uint32_t id = (uint32_t)names_.size();
+        names_.insert(std::make_pair(name, id));
+        return id;
     }
 
-    void endElement(const std::string& name) override {
-        (void)name;
-        if (name == "MenuItem")
-            current_item_ = nullptr;
-        else if (name == "Menu")
-            current_menu_ = nullptr;
-        else if (name == "MainMenu")
-            in_main_menu_ = false;
-        if (!stack_.empty())
-            stack_.pop_back();
+    void warnUnknownElement(const std::string& name) {
+        uint64_t key = ((uint64_t)UiDiagnosticCode::UnknownElement << 56) | intern(name);
+        if (!countRepeat(key))
+            addWarning(key, UiDiagnosticCode::UnknownElement, name);
     }
 
-private:
-    bool isKnownElement(const std::string& name) const {
-        return name == "MainMenu" || name == "Menu" || name == "MenuItem" || name == "Separator" ||
-               name == "DockLayout" || name == "MenuBar" || name == "ToolBar" || name == "StatusBar" ||
-               name == "PropertyPanel" || name == "Viewport3D" || name == "Overlay" ||
-               name == "Window" || name == "state" || name == "Label" || name == "Top" ||
-               name == "Bottom" || name == "Left" || name == "Right" || name == "Center" ||
-               name == "ToolButton";
-    }
-
-    void warnOnce(const std::string& message, const std::string& detail) {
-        std::string key = message + ":" + detail;
-        if (warning_cache_.insert(key).second) {
-            std::cerr << "UI Warning: " << message << " -> " << detail << std::endl;
-        }
+    void warnUnknownProperty(ElementId element, const std::string& name) {
+        // Known elements key by id, unknown ones by their interned name.
+        uint64_t element_key = element == ElementId::Unknown ? (uint64_t)ElementId::Count + intern(unknown_names_.back())
+                                                             : (uint64_t)element;
+        uint64_t key = ((uint64_t)UiDiagnosticCode::UnknownProperty << 56) | (element_key << 28) | intern(name);
+        if (countRepeat(key))
+            return;
+        const std::string element_name = element == ElementId::Unknown ? unknown_names_.back() : ElementName(element);
+        addWarning(key, UiDiagnosticCode::UnknownProperty, element_name + "." + name);
+    }
+
+    bool countRepeat(uint64_t key) {
+        std::unordered_map<uint64_t, size_t>::iterator it = seen_.find(key);
+        if (it == seen_.end())
+            return false;
+        ++diagnostics_[it->second].count;
+        return true;
+    }
+
+    void addWarning(uint64_t key, UiDiagnosticCode code, const std::string& detail) {
+        UiDiagnostic diagnostic;
+        diagnostic.severity = UiSeverity::Warning;
+        diagnostic.code = code;
+        diagnostic.detail = detail;
+        diagnostic.line = locator_.line();
+        diagnostic.column = locator_.column();
+        seen_.insert(std::make_pair(key, diagnostics_.size()));
+        diagnostics_.push_back(diagnostic);
     }
 
     UiWindow* model_;
-    std::vector<std::string> stack_;
+    std::vector<ElementId> stack_;
+    std::vector<std::string> unknown_names_;
+    std::vector<UiNodeTree::Index> nodes_;
     UiMenu* current_menu_ = nullptr;
     UiMenuItem* current_item_ = nullptr;
     bool in_main_menu_ = false;
-    std::set<std::string> warning_cache_;
+    SourceLocator locator_;
+    std::unordered_map<std::string, uint32_t> names_;
+    std::unordered_map<uint64_t, size_t> seen_;
+    std::vector<UiDiagnostic> diagnostics_;
 };
 
+std::shared_ptr<const UiSchema> UiSchema::builtin() {
+    static const std::shared_ptr<const UiSchema> schema = [] {
+        static const char* const kBuiltinEnums[][2] = {
+            {"icon", "play"},
+            {"icon", "select"},
+            {"icon", "move"},
+            {"icon", "paint"},
+            {"action", "open"},
+            {"action", "save"},
+            {"action", "saveAs"},
+            {"action", "closeQuery"},
+            {"persist", "user"},
+            {"persist", "project"},
+            {"persist", "session"},
+            {"presentMode", "throughput"},
+            {"presentMode", "latency"},
+        };
+        std::shared_ptr<UiSchema> built = std::make_shared<UiSchema>();
+        for (size_t i = 0; i < sizeof(kBuiltinEnums) / sizeof(kBuiltinEnums[0]); ++i) {
+            EnumValue value;
+            value.property = kBuiltinEnums[i][0];
+            value.value = kBuiltinEnums[i][1];
+            built->enum_values_.push_back(value);
+        }
+        return std::shared_ptr<const UiSchema>(built);
+    }();
+    return schema;
+}
+
+std::shared_ptr<const UiSchema> UiSchema::withEnumValues(const std::vector<EnumValue>& values) const {
+    std::shared_ptr<UiSchema> extended = std::make_shared<UiSchema>(*this);
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (!hasEnumValue(values[i].property, values[i].value))
+            extended->enum_values_.push_back(values[i]);
+    }
+    return extended;
+}
+
+bool UiSchema::hasEnumValue(const std::string& property, const std::string& value) const {
+    for (size_t i = 0; i < enum_values_.size(); ++i) {
+        if (enum_values_[i].property == property && enum_values_[i].value == value)
+            return true;
+    }
+    return false;
+}
+
+void UiSchema::attach(sml::SmlSaxParser& parser) const {
+    for (size_t i = 0; i < enum_values_.size(); ++i)
+        parser.registerEnumValue(enum_values_[i].property, enum_values_[i].value);
+}
+
+void UiDocument::postDiagnostics(std::vector<UiDiagnostic> batch) {
+    if (batch.empty())
+        return;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (batch[i].severity == UiSeverity::Error)
+            error_count_ += batch[i].count;
+        else if (batch[i].severity == UiSeverity::Warning)
+            warning_count_ += batch[i].count;
+    }
+    if (UiDiagnosticsWriter* writer = diagnostics_writer_.load())
+        writer->post(batch);
+    diagnostics_.push(std::move(batch));
+}
+
+UiDiagnosticCounters UiDocument::diagnosticCounters() const {
+    UiDiagnosticCounters counters;
+    counters.warnings = warning_count_.load();
+    counters.errors = error_count_.load();
+    return counters;
+}
+
+void UiDocument::setSchema(std::shared_ptr<const UiSchema> schema) {
+    std::atomic_store(&schema_, schema ? std::move(schema) : UiSchema::builtin());
+}
+
 bool UiDocument::parseFromString(const std::string& text, std::string* error_message) {
-    UiSmlHandler handler(&window_);
+    std::shared_ptr<UiWindow> next = std::make_shared<UiWindow>();
+    UiSmlHandler handler(next.get(), &text);
     try {
         sml::SmlSaxParser parser(text);
-        parser.registerEnumValue("icon", "play");
-        parser.registerEnumValue("icon", "select");
-        parser.registerEnumValue("icon", "move");
-        parser.registerEnumValue("icon", "paint");
-        parser.registerEnumValue("action", "open");
-        parser.registerEnumValue("action", "save");
-        parser.registerEnumValue("action", "saveAs");
-        parser.registerEnumValue("action", "closeQuery");
-        parser.registerEnumValue("persist", "user");
-        parser.registerEnumValue("persist", "project");
-        parser.registerEnumValue("persist", "session");
+        schema()->attach(parser);
         parser.parse(handler);
     } catch (const sml::SmlParseException& e) {
         if (error_message)
             *error_message = e.what();
+        std::vector<UiDiagnostic> diagnostics = handler.takeDiagnostics();
+        UiDiagnostic error;
+        error.severity = UiSeverity::Error;
+        error.code = UiDiagnosticCode::ParseError;
+        error.detail = e.what();
+        diagnostics.push_back(error);
+        postDiagnostics(std::move(diagnostics));
         return false;
     }
+    postDiagnostics(handler.takeDiagnostics());
+    next->tree.finalize();
+    publish(std::move(next));
     return true;
 }
 
+// Everything render() would otherwise derive per frame: fallback titles,
+// button labels and menu item state. Built once per published UiWindow;
+// the const char* members point into `window` or at string literals.
+struct UiDocument::RenderModel {
+    struct MenuItem {
+        const char* label = nullptr;
+        int action_id = 0;
+        bool enabled = false;
+        bool separator = false;
+        bool hidden_on_mac = false;
+    };
+    struct Menu {
+        const char* label = nullptr;
+        std::vector<MenuItem> items;
+    };
+    struct Tool {
+        std::string label;
+        bool is_play = false;
+    };
+
+    std::shared_ptr<const UiWindow> window;
+    bool show_main_menu = false;
+    std::vector<Menu> menus;
+    const char* root_title = nullptr;
+    const char* label_text = nullptr;
+    const char* top_title = nullptr;
+    const char* bottom_title = nullptr;
+    const char* left_title = nullptr;
+    const char* right_title = nullptr;
+    const char* center_title = nullptr;
+    std::vector<Tool> toolbar_tools;
+    std::vector<Tool> left_tools;
+    // Tree nodes whose widget children are drawn into each area.
+    bool root_has_widgets = false;
+    UiNodeTree::Index root_node = UiNodeTree::kNone;
+    UiNodeTree::Index top_node = UiNodeTree::kNone;
+    UiNodeTree::Index bottom_node = UiNodeTree::kNone;
+    UiNodeTree::Index left_node = UiNodeTree::kNone;
+    UiNodeTree::Index right_node = UiNodeTree::kNone;
+    UiNodeTree::Index center_node = UiNodeTree::kNone;
+    // String properties written as "bind(path)", grouped by node in tree
+    // order. node_bindings maps a node to its first entry and stays empty
+    // when nothing is bound.
+    struct Binding {
+        UiNodeTree::Index node = UiNodeTree::kNone;
+        uint8_t property = 0;
+        std::string path;
+    };
+    static const uint32_t kNoBinding = 0xffffffffu;
+    std::vector<Binding> bindings;
+    std::vector<uint32_t> node_bindings;
+    // Keys of `bindings`, resolved on the render thread the first time the
+    // model is drawn after a setBindings(). bound_generation is compared
+    // rather than the pointer, which a new UiBindings may reuse.
+    mutable uint64_t bound_generation = 0;
+    mutable std::vector<UiBindings::Key> binding_keys;
+};
+
+const uint32_t UiDocument::RenderModel::kNoBinding;
+
+// Elements drawn by renderNodes(); everything else is either handled by
+// the fixed dock layout or ignored.
+static bool IsWidget(ElementId type) {
+    switch (type) {
+    case ElementId::Label:
+    case ElementId::Button:
+    case ElementId::Separator:
+    case ElementId::Column:
+    case ElementId::Row:
+    case ElementId::ListView:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Last matching child, so repeated elements override like repeated properties.
+static UiNodeTree::Index FindChild(const UiNodeTree& tree, UiNodeTree::Index parent, ElementId type) {
+    UiNodeTree::Index found = UiNodeTree::kNone;
+    UiNodeTree::Index node = parent == UiNodeTree::kNone ? tree.root() : tree.firstChild(parent);
+    for (; node != UiNodeTree::kNone; node = tree.nextSibling(node)) {
+        if ((ElementId)tree.type(node) == type)
+            found = node;
+    }
+    return found;
+}
+
+// "bind(path)" with optional blanks around path.
+static bool ParseBindPath(const char* text, std::string* path) {
+    static const char kPrefix[] = "bind(";
+    if (std::strncmp(text, kPrefix, sizeof(kPrefix) - 1) != 0)
+        return false;
+    const char* begin = text + sizeof(kPrefix) - 1;
+    const char* end = begin + std::strlen(begin);
+    if (end == begin || end[-1] != ')')
+        return false;
+    --end;
+    while (begin < end && std::isspace(static_cast<unsigned char>(*begin)))
+        ++begin;
+    while (end > begin && std::isspace(static_cast<unsigned char>(end[-1])))
+        --end;
+    if (begin == end)
+        return false;
+    path->assign(begin, end);
+    return true;
+}
+
+static const char* LabelOr(const std::string& text, const char* fallback) {
+    return text.empty() ? fallback : text.c_str();
+}
+
+static ImU32 PackColor(const ImVec4& c) {
+    return IM_COL32((int)(c.x * 255.0f), (int)(c.y * 255.0f), (int)(c.z * 255.0f), (int)(c.w * 255.0f));
+}
+
+UiDocument::UiDocument()
+    : model_(buildRenderModel(std::make_shared<UiWindow>())), schema_(UiSchema::builtin()) {
+    setTheme(theme_);
+}
+
+std::shared_ptr<const UiWindow> UiDocument::snapshot() const {
+    return std::atomic_load(&model_)->window;
+}
+
+const UiWindow& UiDocument::window() const {
+    return *snapshot();
+}
+
+void UiDocument::publish(std::shared_ptr<const UiWindow> window) {
+    std::atomic_store(&model_, buildRenderModel(std::move(window)));
+    ++model_version_;
+    requestRedraw(kSettleFrames);
+}
+
+void UiDocument::setTheme(const UiTheme& theme) {
+    theme_ = theme;
+    theme_colors_.toolbar_bg = PackColor(theme.toolbar_bg);
+    theme_colors_.status_bg = PackColor(theme.status_bg);
+    theme_colors_.status_text = PackColor(theme.status_text);
+    theme_colors_.left_bg = PackColor(theme.left_bg);
+    theme_colors_.right_bg = PackColor(theme.right_bg);
+    theme_colors_.center_bg = PackColor(theme.center_bg);
+    ++model_version_;
+    requestRedraw(kSettleFrames);
+}
+
+void UiDocument::setListSource(const std::string& name, const UiListSource& source) {
+    for (size_t i = 0; i < list_sources_.size(); ++i) {
+        if (list_sources_[i].first != name)
+            continue;
+        if (source.count && source.draw_row)
+            list_sources_[i].second = source;
+        else
+            list_sources_.erase(list_sources_.begin() + (std::ptrdiff_t)i);
+        requestRedraw();
+        return;
+    }
+    if (source.count && source.draw_row)
+        list_sources_.push_back(std::make_pair(name, source));
+    requestRedraw();
+}
+
+void UiDocument::setBindings(UiBindings* bindings) {
+    bindings_ = bindings;
+    ++bindings_generation_;
+    ++model_version_;
+    requestRedraw();
+}
+
+bool UiDocument::needsRedraw() const {
+    if (model_version_.load() != rendered_version_ || redraw_frames_.load() > 0 || interaction_changed_)
+        return true;
+    if (bindings_ && (bindings_->dirty() || bindings_->changeCount() != rendered_binding_changes_))
+        return true;
+    const ImGuiContext* ctx = ImGui::GetCurrentContext();
+    if (!ctx)
+        return true;
+    // Events pushed by the platform backend (mouse, keys, focus) since the
+    // last NewFrame. A focused text field needs frames for the caret blink.
+    return ctx->InputEventsQueue.Size > 0 || ctx->IO.WantTextInput;
+}
+
+void UiDocument::requestRedraw(int frames) {
+    int pending = redraw_frames_.load();
+    while (pending < frames && !redraw_frames_.compare_exchange_weak(pending, frames)) {
+    }
+}
+
+UiFrameStats UiDocument::frameStats() const {
+    UiFrameStats stats;
+    stats.rendered_frames = rendered_frames_.load();
+    stats.skipped_frames = skipped_frames_.load();
+    return stats;
+}
+
+void UiDocument::trackFrame(uint64_t rendered_version) const {
+    rendered_version_ = rendered_version;
+    ImGuiID hovered = ImGui::GetHoveredID();
+    ImGuiID active = ImGui::GetActiveID();
+    // Hover highlights and press states only show up on the next frame; an
+    // active item (drag, held button) keeps animating until released.
+    interaction_changed_ = hovered != last_hovered_id_ || active != last_active_id_ || active != 0;
+    last_hovered_id_ = hovered;
+    last_active_id_ = active;
+    ++rendered_frames_;
+    int pending = redraw_frames_.load();
+    while (pending > 0 && !redraw_frames_.compare_exchange_weak(pending, pending - 1)) {
+    }
+}
+
+void UiDocument::emitAction(UiEventType type, UiEventSource source, int action_id, UiNodeTree::Index node) const {
+    if (!deferred_actions_.load()) {
+        if (type == UiEventType::Action && menu_action_callback_)
+            menu_action_callback_(action_id, menu_action_user_data_);
+        return;
+    }
+    UiEvent event;
+    event.type = type;
+    event.source = source;
+    event.action_id = action_id;
+    event.node = node;
+    event.frame = rendered_frames_.load();
+    event.time = std::chrono::steady_clock::now();
+    events_.push(event);
+}
+
+size_t UiDocument::dispatchEvents(bool coalesce) {
+    std::vector<UiEvent> events;
+    size_t drained = events_.drain(&events, coalesce);
+    for (size_t i = 0; i < events.size(); ++i) {
+        if (events[i].type == UiEventType::Action && menu_action_callback_)
+            menu_action_callback_(events[i].action_id, menu_action_user_data_);
+    }
+    return drained;
+}
+
+std::shared_ptr<const UiDocument::RenderModel> UiDocument::buildRenderModel(std::shared_ptr<const UiWindow> window) {
+    std::shared_ptr<RenderModel> model = std::make_shared<RenderModel>();
+    const UiWindow& w = *window;
+    model->show_main_menu = w.main_menu.enabled && !w.main_menu.menus.empty();
+    model->menus.resize(w.main_menu.menus.size());
+    for (size_t i = 0; i < w.main_menu.menus.size(); ++i) {
+        const UiMenu& menu = w.main_menu.menus[i];
+        RenderModel::Menu& out = model->menus[i];
+        out.label = LabelOr(menu.label, "Menu");
+        out.items.resize(menu.items.size());
+        for (size_t j = 0; j < menu.items.size(); ++j) {
+            const UiMenuItem& item = menu.items[j];
+            RenderModel::MenuItem& entry = out.items[j];
+            entry.label = LabelOr(item.label, "Item");
+            entry.action_id = item.action_id;
+            entry.enabled = item.action_id != 0 || !item.clicked.empty();
+            entry.separator = item.is_separator;
+            entry.hidden_on_mac = item.clicked == "exit" || item.label == "Exit";
+        }
+    }
+    model->root_title = LabelOr(w.title, "Window");
+    model->label_text = LabelOr(w.label.text, "Label");
+    model->top_title = LabelOr(w.dock.top_label, "##Toolbar");
+    model->bottom_title = LabelOr(w.dock.bottom_label, "##Status");
+    model->left_title = LabelOr(w.dock.left_label, "Toolbar");
+    model->right_title = LabelOr(w.dock.right_label, "Properties");
+    model->center_title = LabelOr(w.dock.center_label, "Viewport");
+    model->toolbar_tools.resize(w.dock.toolbar_tools.size());
+    for (size_t i = 0; i < w.dock.toolbar_tools.size(); ++i) {
+        model->toolbar_tools[i].label = std::string("##tool_") + std::to_string(i);
+        model->toolbar_tools[i].is_play = w.dock.toolbar_tools[i] == "play";
+    }
+    model->left_tools.resize(w.dock.left_tools.size());
+    for (size_t i = 0; i < w.dock.left_tools.size(); ++i)
+        model->left_tools[i].label = IconToLabel(w.dock.left_tools[i]);
+    const UiNodeTree& tree = w.tree;
+    model->root_node = FindChild(tree, UiNodeTree::kNone, ElementId::Window);
+    if (model->root_node != UiNodeTree::kNone) {
+        for (UiNodeTree::Index node = tree.firstChild(model->root_node); node != UiNodeTree::kNone; node = tree.nextSibling(node))
+            model->root_has_widgets = model->root_has_widgets || IsWidget((ElementId)tree.type(node));
+        UiNodeTree::Index dock = FindChild(tree, model->root_node, ElementId::DockLayout);
+        if (dock != UiNodeTree::kNone) {
+            model->top_node = FindChild(tree, dock, ElementId::Top);
+            model->bottom_node = FindChild(tree, dock, ElementId::Bottom);
+            model->left_node = FindChild(tree, dock, ElementId::Left);
+            model->right_node = FindChild(tree, dock, ElementId::Right);
+            model->center_node = FindChild(tree, dock, ElementId::Center);
+        }
+    }
+    std::string path;
+    for (UiNodeTree::Index node = 0; node < tree.size(); ++node) {
+        if (!IsWidget((ElementId)tree.type(node)))
+            continue;
+        size_t count = 0;
+        const UiNodeTree::Property* properties = tree.properties(node, &count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!UiNodeTree::isString(properties[i]) || !ParseBindPath(tree.string(properties[i]), &path))
+                continue;
+            if (model->node_bindings.empty())
+                model->node_bindings.assign(tree.size(), RenderModel::kNoBinding);
+            if (model->node_bindings[node] == RenderModel::kNoBinding)
+                model->node_bindings[node] = (uint32_t)model->bindings.size();
+            RenderModel::Binding binding;
+            binding.node = node;
+            binding.property = properties[i].id;
+            binding.path = path;
+            model->bindings.push_back(std::move(binding));
+        }
+    }
+    model->window = std::move(window);
+    return model;
+}
+
 void UiDocument::render(const ImGuiViewport* viewport, ImFont* font_15, bool* out_play_clicked) const {
     if (!viewport)
         return;
+    // Read the version first: a model published in between is then
+    // rendered next frame rather than marked as already drawn.
+    uint64_t version = model_version_.load();
+    const std::shared_ptr<const RenderModel> model = std::atomic_load(&model_);
+    if (bindings_) {
+        // Only derived values whose inputs changed are recomputed; the
+        // widgets below read values by key without copying them.
+        bindings_->update();
+        rendered_binding_changes_ = bindings_->changeCount();
+        if (model->bound_generation != bindings_generation_) {
+            model->binding_keys.resize(model->bindings.size());
+            for (size_t i = 0; i < model->bindings.size(); ++i)
+                model->binding_keys[i] = bindings_->key(model->bindings[i].path);
+            model->bound_generation = bindings_generation_;
+        }
+    }
+    renderModel(*model, geometryFor(model, viewport), viewport, font_15, out_play_clicked);
+    trackFrame(version);
+}
+
+UiDockGeometry UiDocument::dockGeometry(const ImGuiViewport* viewport) const {
+    if (!viewport)
+        return UiDockGeometry();
+    return geometryFor(std::atomic_load(&model_), viewport);
+}
+
+const UiDockGeometry& UiDocument::geometryFor(const std::shared_ptr<const RenderModel>& model, const ImGuiViewport* viewport) const {
+    const ImVec2 origin = viewport->WorkPos;
+    const ImVec2 size = viewport->WorkSize;
+    if (geometry_model_ == model && geometry_work_pos_.x == origin.x && geometry_work_pos_.y == origin.y &&
+        geometry_work_size_.x == size.x && geometry_work_size_.y == size.y)
+        return geometry_;
+    const UiWindow::DockLayout& dock = model->window->dock;
+    UiDockGeometry geometry;
+    geometry.dock_enabled = dock.enabled;
+    if (!dock.enabled) {
+        geometry.center.pos = origin;
+        geometry.center.size = size;
+    } else {
+        float top_h = (float)dock.top_height;
+        float bottom_h = (float)dock.bottom_height;
+        float left_w = (float)dock.left_width;
+        float right_w = (float)dock.right_width;
+        float middle_h = size.y - top_h - bottom_h;
+        if (top_h > 0.0f) {
+            geometry.top.pos = origin;
+            geometry.top.size = ImVec2(size.x, top_h);
+        }
+        if (bottom_h > 0.0f) {
+            geometry.bottom.pos = ImVec2(origin.x, origin.y + size.y - bottom_h);
+            geometry.bottom.size = ImVec2(size.x, bottom_h);
+        }
+        if (left_w > 0.0f) {
+            geometry.left.pos = ImVec2(origin.x, origin.y + top_h);
+            geometry.left.size = ImVec2(left_w, middle_h);
+        }
+        if (right_w > 0.0f) {
+            geometry.right.pos = ImVec2(origin.x + size.x - right_w, origin.y + top_h);
+            geometry.right.size = ImVec2(right_w, middle_h);
+        }
+        geometry.center.pos = ImVec2(origin.x + left_w, origin.y + top_h);
+        geometry.center.size = ImVec2(size.x - left_w - right_w, middle_h);
+    }
+    geometry_ = geometry;
+    geometry_model_ = model;
+    geometry_work_pos_ = origin;
+    geometry_work_size_ = size;
+    return geometry_;
+}
+
+void UiDocument::renderModel(const RenderModel& model, const UiDockGeometry& geometry, const ImGuiViewport* viewport, ImFont* font_15, bool* out_play_clicked) const {
+    const UiWindow& window = *model.window;
     if (out_play_clicked)
         *out_play_clicked = false;
-    if (window_.main_menu.enabled && !window_.main_menu.menus.empty()) {
+    if (model.show_main_menu) {
         auto render_menu = [&](bool is_mac) {
             if (!ImGui::BeginMainMenuBar())
                 return;
-            for (size_t i = 0; i < window_.main_menu.menus.size(); ++i) {
-                const UiMenu& menu = window_.main_menu.menus[i];
-                const char* menu_label = menu.label.empty() ? "Menu" : menu.label.c_str();
-                if (ImGui::BeginMenu(menu_label)) {
+            for (size_t i = 0; i < model.menus.size(); ++i) {
+                const RenderModel::Menu& menu = model.menus[i];
+                if (ImGui::BeginMenu(menu.label)) {
                     for (size_t j = 0; j < menu.items.size(); ++j) {
-                        const UiMenuItem& item = menu.items[j];
-                        if (item.is_separator) {
+                        const RenderModel::MenuItem& item = menu.items[j];
+                        if (item.separator) {
                             ImGui::Separator();
                             continue;
                         }
-                        if (is_mac && (item.clicked == "exit" || item.label == "Exit"))
+                        if (is_mac && item.hidden_on_mac)
                             continue;
-                        const char* item_label = item.label.empty() ? "Item" : item.label.c_str();
-                        bool enabled = item.action_id != 0 || !item.clicked.empty();
-                        if (ImGui::MenuItem(item_label, nullptr, false, enabled)) {
-                            if (menu_action_callback_ && item.action_id != 0)
-                                menu_action_callback_(item.action_id, menu_action_user_data_);
+                        if (ImGui::MenuItem(item.label, nullptr, false, item.enabled)) {
+                            if (item.action_id != 0)
+                                emitAction(UiEventType::Action, UiEventSource::MenuItem, item.action_id, UiNodeTree::kNone);
                         }
                     }
                     ImGui::EndMenu();
@@ -318,35 +947,35 @@ void UiDocument::render(const ImGuiViewport* viewport, ImFont* font_15, bool* ou
         render_menu(false);
 #endif
     }
-    if (!window_.dock.enabled) {
+    if (!window.dock.enabled) {
         ImGui::SetNextWindowViewport(viewport->ID);
-        ImGui::SetNextWindowPos(viewport->WorkPos, ImGuiCond_Always);
-        ImGui::SetNextWindowSize(viewport->WorkSize, ImGuiCond_Always);
+        ImGui::SetNextWindowPos(geometry.center.pos, ImGuiCond_Always);
+        ImGui::SetNextWindowSize(geometry.center.size, ImGuiCond_Always);
         ImGuiWindowFlags root_flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove |
                                       ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings |
                                       ImGuiWindowFlags_NoBringToFrontOnFocus | ImGuiWindowFlags_NoNavFocus |
                                       ImGuiWindowFlags_NoBackground;
         ImGui::SetNextWindowBgAlpha(0.0f);
-        const char* title = window_.title.empty() ? "Window" : window_.title.c_str();
-        ImGui::Begin(title, nullptr, root_flags);
-        ImGui::SetCursorScreenPos(ImVec2(viewport->WorkPos.x + (float)window_.label.position.x,
-                                         viewport->WorkPos.y + (float)window_.label.position.y));
-        if (window_.label.font_size == 15 && font_15)
+        ImGui::Begin(model.root_title, nullptr, root_flags);
+        if (model.root_has_widgets) {
+            renderNodes(model, window.tree.firstChild(model.root_node), font_15, false);
+            ImGui::End();
+            return;
+        }
+        ImGui::SetCursorScreenPos(ImVec2(viewport->WorkPos.x + (float)window.label.position.x,
+                                         viewport->WorkPos.y + (float)window.label.position.y));
+        if (window.label.font_size == 15 && font_15)
             ImGui::PushFont(font_15);
-        const char* label_text = window_.label.text.empty() ? "Label" : window_.label.text.c_str();
-        ImGui::TextUnformatted(label_text);
-        if (window_.label.font_size == 15 && font_15)
+        ImGui::TextUnformatted(model.label_text);
+        if (window.label.font_size == 15 && font_15)
             ImGui::PopFont();
         ImGui::End();
         return;
     }
 
-    ImVec2 origin = viewport->WorkPos;
-    ImVec2 size = viewport->WorkSize;
-    float top_h = (float)window_.dock.top_height;
-    float bottom_h = (float)window_.dock.bottom_height;
-    float left_w = (float)window_.dock.left_width;
-    float right_w = (float)window_.dock.right_width;
+    auto child_of = [&](UiNodeTree::Index node) {
+        return node == UiNodeTree::kNone ? UiNodeTree::kNone : window.tree.firstChild(node);
+    };
 
     auto begin_panel = [&](const char* name, ImVec2 pos, ImVec2 sz, ImU32 bg_color, float bg_alpha, bool show_titlebar) {
         ImGui::SetNextWindowViewport(viewport->ID);
@@ -363,73 +992,161 @@ void UiDocument::render(const ImGuiViewport* viewport, ImFont* font_15, bool* ou
         ImGui::PopStyleColor();
     };
 
-    if (top_h > 0.0f) {
-        const char* top_title = window_.dock.top_label.empty() ? "##Toolbar" : window_.dock.top_label.c_str();
-        ImVec4 tb = theme_.toolbar_bg;
-        begin_panel(top_title, origin, ImVec2(size.x, top_h), IM_COL32((int)(tb.x * 255.0f), (int)(tb.y * 255.0f), (int)(tb.z * 255.0f), (int)(tb.w * 255.0f)), 1.0f, false);
-        if (window_.dock.show_toolbar) {
+    if (geometry.top.size.y > 0.0f) {
+        begin_panel(model.top_title, geometry.top.pos, geometry.top.size, theme_colors_.toolbar_bg, 1.0f, false);
+        if (window.dock.show_toolbar) {
             ImGui::SameLine();
-            for (size_t i = 0; i < window_.dock.toolbar_tools.size(); ++i) {
-                const std::string& icon = window_.dock.toolbar_tools[i];
-                bool is_play = (icon == "play");
+            for (size_t i = 0; i < model.toolbar_tools.size(); ++i) {
+                const RenderModel::Tool& tool = model.toolbar_tools[i];
                 if (i > 0)
                     ImGui::SameLine();
-                std::string label = std::string("##tool_") + std::to_string(i);
-                bool clicked = DrawToolButton(label.c_str(), is_play);
-                if (clicked && is_play && out_play_clicked)
-                    *out_play_clicked = true;
+                bool clicked = DrawToolButton(tool.label.c_str(), tool.is_play);
+                if (clicked && tool.is_play) {
+                    if (out_play_clicked)
+                        *out_play_clicked = true;
+                    emitAction(UiEventType::Play, UiEventSource::ToolButton, 0, UiNodeTree::kNone);
+                }
             }
         }
+        renderNodes(model, child_of(model.top_node), font_15, false);
         ImGui::End();
     }
 
-    if (bottom_h > 0.0f) {
-        const char* bottom_title = window_.dock.bottom_label.empty() ? "##Status" : window_.dock.bottom_label.c_str();
-        ImVec4 sb = theme_.status_bg;
-        begin_panel(bottom_title, ImVec2(origin.x, origin.y + size.y - bottom_h), ImVec2(size.x, bottom_h), IM_COL32((int)(sb.x * 255.0f), (int)(sb.y * 255.0f), (int)(sb.z * 255.0f), (int)(sb.w * 255.0f)), 1.0f, false);
-        ImVec4 st = theme_.status_text;
-        ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32((int)(st.x * 255.0f), (int)(st.y * 255.0f), (int)(st.z * 255.0f), (int)(st.w * 255.0f)));
-        if (window_.dock.show_statusbar) {
+    if (geometry.bottom.size.y > 0.0f) {
+        begin_panel(model.bottom_title, geometry.bottom.pos, geometry.bottom.size, theme_colors_.status_bg, 1.0f, false);
+        ImGui::PushStyleColor(ImGuiCol_Text, theme_colors_.status_text);
+        if (window.dock.show_statusbar) {
             ImGui::TextUnformatted("dungeon.sml loaded");
         }
+        renderNodes(model, child_of(model.bottom_node), font_15, false);
         ImGui::PopStyleColor();
         ImGui::End();
     }
 
-    if (left_w > 0.0f) {
-        const char* left_title = window_.dock.left_label.empty() ? "Toolbar" : window_.dock.left_label.c_str();
-        ImVec4 lb = theme_.left_bg;
-        begin_panel(left_title, ImVec2(origin.x, origin.y + top_h), ImVec2(left_w, size.y - top_h - bottom_h), IM_COL32((int)(lb.x * 255.0f), (int)(lb.y * 255.0f), (int)(lb.z * 255.0f), (int)(lb.w * 255.0f)), 1.0f, true);
-        for (size_t i = 0; i < window_.dock.left_tools.size(); ++i) {
-            const std::string& icon = window_.dock.left_tools[i];
-            std::string label = IconToLabel(icon);
-            DrawToolButton(label.c_str(), false);
-        }
+    if (geometry.left.size.x > 0.0f) {
+        begin_panel(model.left_title, geometry.left.pos, geometry.left.size, theme_colors_.left_bg, 1.0f, true);
+        for (size_t i = 0; i < model.left_tools.size(); ++i)
+            DrawToolButton(model.left_tools[i].label.c_str(), false);
+        renderNodes(model, child_of(model.left_node), font_15, false);
         ImGui::End();
     }
 
-    if (right_w > 0.0f) {
-        const char* right_title = window_.dock.right_label.empty() ? "Properties" : window_.dock.right_label.c_str();
-        ImVec4 rb = theme_.right_bg;
-        begin_panel(right_title, ImVec2(origin.x + size.x - right_w, origin.y + top_h), ImVec2(right_w, size.y - top_h - bottom_h), IM_COL32((int)(rb.x * 255.0f), (int)(rb.y * 255.0f), (int)(rb.z * 255.0f), (int)(rb.w * 255.0f)), 1.0f, true);
-        if (window_.dock.show_property_panel) {
+    if (geometry.right.size.x > 0.0f) {
+        begin_panel(model.right_title, geometry.right.pos, geometry.right.size, theme_colors_.right_bg, 1.0f, true);
+        if (window.dock.show_property_panel) {
             ImGui::TextUnformatted("Properties");
             if (property_panel_callback_) {
                 property_panel_callback_(ImGui::GetWindowPos(), ImGui::GetWindowSize(), property_panel_user_data_);
             }
         }
+        renderNodes(model, child_of(model.right_node), font_15, false);
         ImGui::End();
     }
 
-    const char* center_title = window_.dock.center_label.empty() ? "Viewport" : window_.dock.center_label.c_str();
-    ImVec4 cb = theme_.center_bg;
-    begin_panel(center_title,
-                ImVec2(origin.x + left_w, origin.y + top_h),
-                ImVec2(size.x - left_w - right_w, size.y - top_h - bottom_h),
-                IM_COL32((int)(cb.x * 255.0f), (int)(cb.y * 255.0f), (int)(cb.z * 255.0f), (int)(cb.w * 255.0f)), cb.w, true);
-    if (window_.dock.show_viewport)
+    begin_panel(model.center_title, geometry.center.pos, geometry.center.size, theme_colors_.center_bg, theme_.center_bg.w, true);
+    if (window.dock.show_viewport)
         ImGui::TextUnformatted("Viewport");
+    renderNodes(model, child_of(model.center_node), font_15, false);
     ImGui::End();
 }
 
+void UiDocument::renderNodes(const RenderModel& model, UiNodeTree::Index first, ImFont* font_15, bool same_line) const {
+    const UiNodeTree& tree = model.window->tree;
+    bool first_widget = true;
+    for (UiNodeTree::Index node = first; node != UiNodeTree::kNone; node = tree.nextSibling(node)) {
+        const ElementId type = (ElementId)tree.type(node);
+        if (!IsWidget(type))
+            continue;
+        if (same_line && !first_widget)
+            ImGui::SameLine();
+        first_widget = false;
+        ImGui::PushID((int)node);
+        switch (type) {
+        case ElementId::Label: {
+            const UiNodeTree::Property* position = tree.findProperty(node, (uint8_t)PropertyId::Position);
+            if (position && position->kind == sml::PropertyValue::Vec2iType)
+                ImGui::SetCursorPos(ImVec2((float)position->x, (float)position->y));
+            bool large = tree.intOr(node, (uint8_t)PropertyId::FontSize, 13) == 15 && font_15;
+            if (large)
+                ImGui::PushFont(font_15);
+            ImGui::TextUnformatted(propertyString(model, node, (uint8_t)PropertyId::Text, "Label"));
+            if (large)
+                ImGui::PopFont();
+            break;
+        }
+        case ElementId::Button: {
+            ImVec2 size((float)tree.intOr(node, (uint8_t)PropertyId::Width, 0),
+                        (float)tree.intOr(node, (uint8_t)PropertyId::Height, 0));
+            if (ImGui::Button(propertyString(model, node, (uint8_t)PropertyId::Label, "Button"), size)) {
+                const char* action = tree.stringOr(node, (uint8_t)PropertyId::Action, nullptr);
+                int action_id = action ? MenuActionIdFor(action) : 0;
+                if (action_id != 0)
+                    emitAction(UiEventType::Action, UiEventSource::Button, action_id, node);
+            }
+            break;
+        }
+        case ElementId::Separator:
+            ImGui::Separator();
+            break;
+        case ElementId::ListView:
+            renderListView(tree, node);
+            break;
+        case ElementId::Column:
+        case ElementId::Row:
+            ImGui::BeginGroup();
+            renderNodes(model, tree.firstChild(node), font_15, type == ElementId::Row);
+            ImGui::EndGroup();
+            break;
+        default:
+            break;
+        }
+        ImGui::PopID();
+    }
+}
+
+const char* UiDocument::propertyString(const RenderModel& model, UiNodeTree::Index node, uint8_t property, const char* fallback) const {
+    if (!model.node_bindings.empty() && model.node_bindings[node] != RenderModel::kNoBinding) {
+        for (uint32_t i = model.node_bindings[node]; i < model.bindings.size() && model.bindings[i].node == node; ++i) {
+            if (model.bindings[i].property != property)
+                continue;
+            if (!bindings_ || model.bound_generation != bindings_generation_)
+                return "";
+            return bindings_->value(model.binding_keys[i]).c_str();
+        }
+    }
+    return model.window->tree.stringOr(node, property, fallback);
+}
+
+void UiDocument::renderListView(const UiNodeTree& tree, UiNodeTree::Index node) const {
+    const char* name = tree.stringOr(node, (uint8_t)PropertyId::Source, "");
+    const UiListSource* source = nullptr;
+    for (size_t i = 0; i < list_sources_.size(); ++i) {
+        if (list_sources_[i].first == name) {
+            source = &list_sources_[i].second;
+            break;
+        }
+    }
+    // Height 0 fills the rest of the panel.
+    ImVec2 size(0.0f, (float)tree.intOr(node, (uint8_t)PropertyId::Height, 0));
+    if (!ImGui::BeginChild("##list", size, ImGuiChildFlags_None)) {
+        ImGui::EndChild();
+        return;
+    }
+    if (source) {
+        size_t count = source->count(source->user_data);
+        // The clipper measures the first row and then only hands out the
+        // visible range, so the cost per frame does not depend on count.
+        ImGuiListClipper clipper;
+        clipper.Begin(count > (size_t)INT_MAX ? INT_MAX : (int)count);
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                ImGui::PushID(row);
+                source->draw_row((size_t)row, source->user_data);
+                ImGui::PopID();
+            }
+        }
+    }
+    ImGui::EndChild();
+}
+
 } // namespace smlui
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_binding.h"
+
+#include <algorithm>
+
+namespace smlui {
+
+const UiBindings::Key UiBindings::kInvalid;
+
+UiBindings::Key UiBindings::key(const std::string& path) {
+    std::unordered_map<std::string, Key>::iterator it = keys_.find(path);
+    if (it != keys_.end())
+        return it->second;
+    Key key = (Key)values_.size();
+    keys_.insert(std::make_pair(path, key));
+    values_.push_back(std::string());
+    versions_.push_back(0);
+    levels_.push_back(0);
+    derived_index_.push_back(-1);
+    dependents_.push_back(std::vector<Key>());
+    dirty_flags_.push_back(0);
+    return key;
+}
+
+UiBindings::Key UiBindings::find(const std::string& path) const {
+    std::unordered_map<std::string, Key>::const_iterator it = keys_.find(path);
+    return it == keys_.end() ? kInvalid : it->second;
+}
+
+const std::string& UiBindings::value(Key key) const {
+    static const std::string kEmpty;
+    return key < values_.size() ? values_[key] : kEmpty;
+}
+
+const std::string& UiBindings::value(const std::string& path) const {
+    return value(find(path));
+}
+
+bool UiBindings::set(Key key, const std::string& value) {
+    if (key >= values_.size() || derived_index_[key] >= 0)
+        return false;
+    if (!store(key, value))
+        return false;
+    markDependents(key);
+    return true;
+}
+
+bool UiBindings::set(Key key, int value) {
+    return set(key, std::to_string(value));
+}
+
+UiBindings::Key UiBindings::define(const std::string& path, const std::vector<std::string>& inputs,
+                                   ComputeCallback compute, void* user_data) {
+    if (!compute)
+        return kInvalid;
+    Key target = key(path);
+    if (derived_index_[target] >= 0 || !dependents_[target].empty())
+        return kInvalid;
+    Derived derived;
+    derived.compute = compute;
+    derived.user_data = user_data;
+    uint32_t level = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        Key input = key(inputs[i]);
+        if (input == target)
+            return kInvalid;
+        derived.inputs.push_back(input);
+        level = std::max(level, levels_[input]);
+    }
+    for (size_t i = 0; i < derived.inputs.size(); ++i)
+        dependents_[derived.inputs[i]].push_back(target);
+    levels_[target] = level + 1;
+    derived_index_[target] = (int32_t)derived_.size();
+    derived_.push_back(derived);
+    // Computed on the next update().
+    dirty_flags_[target] = 1;
+    dirty_.push_back(target);
+    return target;
+}
+
+size_t UiBindings::update() {
+    if (dirty_.empty())
+        return 0;
+    size_t evaluated = 0;
+    std::string next;
+    while (!dirty_.empty()) {
+        // Lowest level first, so a value is computed after all of its
+        // inputs; dependents marked while evaluating land in later rounds.
+        std::vector<Key> batch;
+        batch.swap(dirty_);
+        std::sort(batch.begin(), batch.end(), [this](Key a, Key b) { return levels_[a] < levels_[b]; });
+        uint32_t level = levels_[batch.front()];
+        for (size_t i = 0; i < batch.size(); ++i) {
+            Key key = batch[i];
+            if (levels_[key] != level) {
+                dirty_.push_back(key);
+                continue;
+            }
+            dirty_flags_[key] = 0;
+            const Derived& derived = derived_[derived_index_[key]];
+            next.clear();
+            derived.compute(*this, derived.inputs.data(), derived.inputs.size(), &next, derived.user_data);
+            ++evaluated;
+            if (store(key, next))
+                markDependents(key);
+        }
+    }
+    return evaluated;
+}
+
+bool UiBindings::store(Key key, std::string value) {
+    if (values_[key] == value && versions_[key] != 0)
+        return false;
+    values_[key].swap(value);
+    ++versions_[key];
+    ++change_count_;
+    return true;
+}
+
+void UiBindings::markDependents(Key key) {
+    const std::vector<Key>& dependents = dependents_[key];
+    for (size_t i = 0; i < dependents.size(); ++i) {
+        if (!dirty_flags_[dependents[i]]) {
+            dirty_flags_[dependents[i]] = 1;
+            dirty_.push_back(dependents[i]);
+        }
+    }
+}
+
+} // namespace smlui
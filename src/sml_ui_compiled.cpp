@@ -0,0 +1,616 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Precompiled layout format (.smlb).
+//
+// A blob is a header followed by fixed-size record sections and a string
+// pool. Every reference is an offset from the start of the blob, so the
+// file can be mapped at any address. Records are little-endian PODs:
+//
+//   SmlbHeader
+//   SmlbWindow                      (exactly one)
+//   SmlbMenu[menu_count]            (items are a range into SmlbItem[])
+//   SmlbItem[item_count]
+//   SmlbString[tool_count]          (toolbar tools, then left tools)
+//   SmlbNode[node_count]            (UiNodeTree in index order)
+//   SmlbNodeProperty[node_property_count]
+//   char strings[strings_size]      (not NUL-terminated)
+//
+// Bump kSmlbVersion whenever a record layout changes; older blobs are
+// rejected and must be recompiled from their .sml source.
+
+#include "sml_ui.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace smlui {
+
+namespace {
+
+const char kSmlbMagic[4] = {'S', 'M', 'L', 'B'};
+const uint32_t kSmlbVersion = 3;
+const uint32_t kSmlbEndianTag = 0x01020304u;
+
+struct SmlbString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SmlbHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t endian_tag;
+    uint32_t file_size;
+    uint32_t window_offset;
+    uint32_t menus_offset;
+    uint32_t menu_count;
+    uint32_t items_offset;
+    uint32_t item_count;
+    uint32_t tools_offset;
+    uint32_t toolbar_tool_count;
+    uint32_t left_tool_count;
+    uint32_t nodes_offset;
+    uint32_t node_count;
+    uint32_t node_properties_offset;
+    uint32_t node_property_count;
+    uint32_t strings_offset;
+    uint32_t strings_size;
+};
+
+enum SmlbDockFlags : uint32_t {
+    SmlbDock_Enabled = 1u << 0,
+    SmlbDock_MenuBar = 1u << 1,
+    SmlbDock_ToolBar = 1u << 2,
+    SmlbDock_StatusBar = 1u << 3,
+    SmlbDock_PropertyPanel = 1u << 4,
+    SmlbDock_Viewport = 1u << 5,
+    SmlbDock_Overlay = 1u << 6,
+};
+
+enum SmlbStateFlags : uint32_t {
+    SmlbState_Pos = 1u << 0,
+    SmlbState_Size = 1u << 1,
+    SmlbState_Maximized = 1u << 2,
+    SmlbState_LastFilePath = 1u << 3,
+    SmlbState_Docking = 1u << 4,
+};
+
+struct SmlbWindow {
+    SmlbString title;
+    int32_t position[2];
+    int32_t size[2];
+    int32_t label_position[2];
+    SmlbString label_text;
+    int32_t label_font_size;
+    uint32_t main_menu_enabled;
+    uint32_t dock_flags;
+    int32_t top_height;
+    int32_t bottom_height;
+    int32_t left_width;
+    int32_t right_width;
+    SmlbString top_label;
+    SmlbString bottom_label;
+    SmlbString left_label;
+    SmlbString right_label;
+    SmlbString center_label;
+    uint32_t state_flags;
+    SmlbString persist;
+    SmlbString last_file_path_value;
+    SmlbString theme;
+    SmlbString present_mode;
+    int32_t frames_in_flight;
+};
+
+struct SmlbMenu {
+    SmlbString label;
+    uint32_t first_item;
+    uint32_t item_count;
+};
+
+enum SmlbItemFlags : uint32_t {
+    SmlbItem_UseOnMac = 1u << 0,
+    SmlbItem_Separator = 1u << 1,
+};
+
+struct SmlbItem {
+    SmlbString label;
+    SmlbString clicked;
+    SmlbString action;
+    int32_t action_id;
+    uint32_t flags;
+};
+
+struct SmlbNode {
+    uint32_t parent;            // UiNodeTree::kNone for roots
+    uint32_t type;
+    uint32_t first_property;
+    uint32_t property_count;
+};
+
+struct SmlbNodeProperty {
+    uint32_t id;
+    uint32_t kind;              // sml::PropertyValue::Type
+    int32_t x;                  // string kinds: offset into the string pool
+    int32_t y;                  // string kinds: length
+};
+
+static_assert(sizeof(SmlbString) == 8, "SmlbString layout changed");
+static_assert(sizeof(SmlbHeader) == 72, "SmlbHeader layout changed");
+static_assert(sizeof(SmlbWindow) == 148, "SmlbWindow layout changed");
+static_assert(sizeof(SmlbMenu) == 16, "SmlbMenu layout changed");
+static_assert(sizeof(SmlbItem) == 32, "SmlbItem layout changed");
+static_assert(sizeof(SmlbNode) == 16, "SmlbNode layout changed");
+static_assert(sizeof(SmlbNodeProperty) == 16, "SmlbNodeProperty layout changed");
+
+class StringPool {
+public:
+    SmlbString add(const std::string& text) {
+        return add(text.data(), text.size());
+    }
+    SmlbString add(const char* text, size_t length) {
+        SmlbString ref;
+        ref.offset = (uint32_t)data_.size();
+        ref.length = (uint32_t)length;
+        data_.insert(data_.end(), text, text + length);
+        return ref;
+    }
+    const std::vector<char>& data() const { return data_; }
+
+private:
+    std::vector<char> data_;
+};
+
+template <typename T>
+void AppendRecord(std::vector<char>* out, const T& record) {
+    const char* bytes = reinterpret_cast<const char*>(&record);
+    out->insert(out->end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void AppendRecords(std::vector<char>* out, const std::vector<T>& records) {
+    for (size_t i = 0; i < records.size(); ++i)
+        AppendRecord(out, records[i]);
+}
+
+void CompileWindow(const UiWindow& window, std::vector<char>* out) {
+    StringPool pool;
+    SmlbWindow w;
+    std::memset(&w, 0, sizeof(w));
+    w.title = pool.add(window.title);
+    w.position[0] = window.position.x;
+    w.position[1] = window.position.y;
+    w.size[0] = window.size.x;
+    w.size[1] = window.size.y;
+    w.label_position[0] = window.label.position.x;
+    w.label_position[1] = window.label.position.y;
+    w.label_text = pool.add(window.label.text);
+    w.label_font_size = window.label.font_size;
+    w.main_menu_enabled = window.main_menu.enabled ? 1u : 0u;
+
+    const UiWindow::DockLayout& dock = window.dock;
+    w.dock_flags = (dock.enabled ? SmlbDock_Enabled : 0u) |
+                   (dock.show_menubar ? SmlbDock_MenuBar : 0u) |
+                   (dock.show_toolbar ? SmlbDock_ToolBar : 0u) |
+                   (dock.show_statusbar ? SmlbDock_StatusBar : 0u) |
+                   (dock.show_property_panel ? SmlbDock_PropertyPanel : 0u) |
+                   (dock.show_viewport ? SmlbDock_Viewport : 0u) |
+                   (dock.show_overlay ? SmlbDock_Overlay : 0u);
+    w.top_height = dock.top_height;
+    w.bottom_height = dock.bottom_height;
+    w.left_width = dock.left_width;
+    w.right_width = dock.right_width;
+    w.top_label = pool.add(dock.top_label);
+    w.bottom_label = pool.add(dock.bottom_label);
+    w.left_label = pool.add(dock.left_label);
+    w.right_label = pool.add(dock.right_label);
+    w.center_label = pool.add(dock.center_label);
+
+    const UiWindow::UiState& state = window.state;
+    w.state_flags = (state.pos ? SmlbState_Pos : 0u) |
+                    (state.size ? SmlbState_Size : 0u) |
+                    (state.maximized ? SmlbState_Maximized : 0u) |
+                    (state.last_file_path ? SmlbState_LastFilePath : 0u) |
+                    (state.docking ? SmlbState_Docking : 0u);
+    w.persist = pool.add(state.persist);
+    w.last_file_path_value = pool.add(state.last_file_path_value);
+    w.theme = pool.add(state.theme);
+    w.present_mode = pool.add(state.present_mode);
+    w.frames_in_flight = state.frames_in_flight;
+
+    std::vector<SmlbMenu> menus;
+    std::vector<SmlbItem> items;
+    for (size_t i = 0; i < window.main_menu.menus.size(); ++i) {
+        const UiMenu& menu = window.main_menu.menus[i];
+        SmlbMenu m;
+        m.label = pool.add(menu.label);
+        m.first_item = (uint32_t)items.size();
+        m.item_count = (uint32_t)menu.items.size();
+        menus.push_back(m);
+        for (size_t j = 0; j < menu.items.size(); ++j) {
+            const UiMenuItem& item = menu.items[j];
+            SmlbItem it;
+            it.label = pool.add(item.label);
+            it.clicked = pool.add(item.clicked);
+            it.action = pool.add(item.action);
+            it.action_id = item.action_id;
+            it.flags = (item.use_on_mac ? SmlbItem_UseOnMac : 0u) | (item.is_separator ? SmlbItem_Separator : 0u);
+            items.push_back(it);
+        }
+    }
+
+    std::vector<SmlbString> tools;
+    for (size_t i = 0; i < dock.toolbar_tools.size(); ++i)
+        tools.push_back(pool.add(dock.toolbar_tools[i]));
+    for (size_t i = 0; i < dock.left_tools.size(); ++i)
+        tools.push_back(pool.add(dock.left_tools[i]));
+
+    const UiNodeTree& tree = window.tree;
+    std::vector<SmlbNode> nodes(tree.size());
+    std::vector<SmlbNodeProperty> node_properties;
+    for (UiNodeTree::Index i = 0; i < (UiNodeTree::Index)tree.size(); ++i) {
+        size_t count = 0;
+        const UiNodeTree::Property* properties = tree.properties(i, &count);
+        nodes[i].parent = tree.parent(i);
+        nodes[i].type = tree.type(i);
+        nodes[i].first_property = (uint32_t)node_properties.size();
+        nodes[i].property_count = (uint32_t)count;
+        for (size_t j = 0; j < count; ++j) {
+            SmlbNodeProperty p;
+            p.id = properties[j].id;
+            p.kind = properties[j].kind;
+            p.x = properties[j].x;
+            p.y = properties[j].y;
+            if (UiNodeTree::isString(properties[j])) {
+                SmlbString ref = pool.add(tree.string(properties[j]), (size_t)properties[j].y);
+                p.x = (int32_t)ref.offset;
+                p.y = (int32_t)ref.length;
+            }
+            node_properties.push_back(p);
+        }
+    }
+
+    SmlbHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kSmlbMagic, sizeof(kSmlbMagic));
+    header.version = kSmlbVersion;
+    header.endian_tag = kSmlbEndianTag;
+    header.window_offset = (uint32_t)sizeof(SmlbHeader);
+    header.menus_offset = header.window_offset + (uint32_t)sizeof(SmlbWindow);
+    header.menu_count = (uint32_t)menus.size();
+    header.items_offset = header.menus_offset + header.menu_count * (uint32_t)sizeof(SmlbMenu);
+    header.item_count = (uint32_t)items.size();
+    header.tools_offset = header.items_offset + header.item_count * (uint32_t)sizeof(SmlbItem);
+    header.toolbar_tool_count = (uint32_t)dock.toolbar_tools.size();
+    header.left_tool_count = (uint32_t)dock.left_tools.size();
+    header.nodes_offset = header.tools_offset + (uint32_t)tools.size() * (uint32_t)sizeof(SmlbString);
+    header.node_count = (uint32_t)nodes.size();
+    header.node_properties_offset = header.nodes_offset + header.node_count * (uint32_t)sizeof(SmlbNode);
+    header.node_property_count = (uint32_t)node_properties.size();
+    header.strings_offset = header.node_properties_offset + header.node_property_count * (uint32_t)sizeof(SmlbNodeProperty);
+    header.strings_size = (uint32_t)pool.data().size();
+    header.file_size = header.strings_offset + header.strings_size;
+
+    out->clear();
+    out->reserve(header.file_size);
+    AppendRecord(out, header);
+    AppendRecord(out, w);
+    AppendRecords(out, menus);
+    AppendRecords(out, items);
+    AppendRecords(out, tools);
+    AppendRecords(out, nodes);
+    AppendRecords(out, node_properties);
+    out->insert(out->end(), pool.data().begin(), pool.data().end());
+}
+
+// Reads records out of a mapped blob. All accessors are bounds-checked
+// against the header so a truncated or corrupt file fails cleanly.
+class BlobReader {
+public:
+    BlobReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+    bool validate(std::string* error_message) {
+        if (size_ < sizeof(SmlbHeader))
+            return fail(error_message, "file too small");
+        std::memcpy(&header_, data_, sizeof(header_));
+        if (std::memcmp(header_.magic, kSmlbMagic, sizeof(kSmlbMagic)) != 0)
+            return fail(error_message, "bad magic");
+        if (header_.endian_tag != kSmlbEndianTag)
+            return fail(error_message, "byte order mismatch");
+        if (header_.version != kSmlbVersion)
+            return fail(error_message, "unsupported version " + std::to_string(header_.version));
+        if (header_.file_size != size_)
+            return fail(error_message, "size mismatch");
+        uint64_t tool_count = (uint64_t)header_.toolbar_tool_count + header_.left_tool_count;
+        if (!inRange(header_.window_offset, sizeof(SmlbWindow)) ||
+            !inRange(header_.menus_offset, (uint64_t)header_.menu_count * sizeof(SmlbMenu)) ||
+            !inRange(header_.items_offset, (uint64_t)header_.item_count * sizeof(SmlbItem)) ||
+            !inRange(header_.tools_offset, tool_count * sizeof(SmlbString)) ||
+            !inRange(header_.nodes_offset, (uint64_t)header_.node_count * sizeof(SmlbNode)) ||
+            !inRange(header_.node_properties_offset, (uint64_t)header_.node_property_count * sizeof(SmlbNodeProperty)) ||
+            !inRange(header_.strings_offset, header_.strings_size))
+            return fail(error_message, "section out of range");
+        return true;
+    }
+
+    const SmlbHeader& header() const { return header_; }
+
+    template <typename T>
+    T record(uint32_t section_offset, uint32_t index) const {
+        T value;
+        std::memcpy(&value, data_ + section_offset + (size_t)index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    bool string(const SmlbString& ref, std::string* out) const {
+        if ((uint64_t)ref.offset + ref.length > header_.strings_size)
+            return false;
+        out->assign(data_ + header_.strings_offset + ref.offset, ref.length);
+        return true;
+    }
+
+private:
+    bool inRange(uint32_t offset, uint64_t length) const {
+        return (uint64_t)offset + length <= size_;
+    }
+
+    static bool fail(std::string* error_message, const std::string& reason) {
+        if (error_message)
+            *error_message = "Invalid .smlb: " + reason;
+        return false;
+    }
+
+    const char* data_;
+    size_t size_;
+    SmlbHeader header_;
+};
+
+bool DecodeWindow(const BlobReader& blob, UiWindow* window) {
+    const SmlbHeader& header = blob.header();
+    SmlbWindow w = blob.record<SmlbWindow>(header.window_offset, 0);
+    bool ok = blob.string(w.title, &window->title);
+    window->position.x = w.position[0];
+    window->position.y = w.position[1];
+    window->size.x = w.size[0];
+    window->size.y = w.size[1];
+    window->label.position.x = w.label_position[0];
+    window->label.position.y = w.label_position[1];
+    ok = ok && blob.string(w.label_text, &window->label.text);
+    window->label.font_size = w.label_font_size;
+    window->main_menu.enabled = w.main_menu_enabled != 0;
+
+    UiWindow::DockLayout& dock = window->dock;
+    dock.enabled = (w.dock_flags & SmlbDock_Enabled) != 0;
+    dock.show_menubar = (w.dock_flags & SmlbDock_MenuBar) != 0;
+    dock.show_toolbar = (w.dock_flags & SmlbDock_ToolBar) != 0;
+    dock.show_statusbar = (w.dock_flags & SmlbDock_StatusBar) != 0;
+    dock.show_property_panel = (w.dock_flags & SmlbDock_PropertyPanel) != 0;
+    dock.show_viewport = (w.dock_flags & SmlbDock_Viewport) != 0;
+    dock.show_overlay = (w.dock_flags & SmlbDock_Overlay) != 0;
+    dock.top_height = w.top_height;
+    dock.bottom_height = w.bottom_height;
+    dock.left_width = w.left_width;
+    dock.right_width = w.right_width;
+    ok = ok && blob.string(w.top_label, &dock.top_label);
+    ok = ok && blob.string(w.bottom_label, &dock.bottom_label);
+    ok = ok && blob.string(w.left_label, &dock.left_label);
+    ok = ok && blob.string(w.right_label, &dock.right_label);
+    ok = ok && blob.string(w.center_label, &dock.center_label);
+
+    UiWindow::UiState& state = window->state;
+    state.pos = (w.state_flags & SmlbState_Pos) != 0;
+    state.size = (w.state_flags & SmlbState_Size) != 0;
+    state.maximized = (w.state_flags & SmlbState_Maximized) != 0;
+    state.last_file_path = (w.state_flags & SmlbState_LastFilePath) != 0;
+    state.docking = (w.state_flags & SmlbState_Docking) != 0;
+    ok = ok && blob.string(w.persist, &state.persist);
+    ok = ok && blob.string(w.last_file_path_value, &state.last_file_path_value);
+    ok = ok && blob.string(w.theme, &state.theme);
+    ok = ok && blob.string(w.present_mode, &state.present_mode);
+    state.frames_in_flight = w.frames_in_flight;
+
+    window->main_menu.menus.resize(header.menu_count);
+    for (uint32_t i = 0; ok && i < header.menu_count; ++i) {
+        SmlbMenu m = blob.record<SmlbMenu>(header.menus_offset, i);
+        if ((uint64_t)m.first_item + m.item_count > header.item_count)
+            return false;
+        UiMenu& menu = window->main_menu.menus[i];
+        ok = blob.string(m.label, &menu.label);
+        menu.items.resize(m.item_count);
+        for (uint32_t j = 0; ok && j < m.item_count; ++j) {
+            SmlbItem it = blob.record<SmlbItem>(header.items_offset, m.first_item + j);
+            UiMenuItem& item = menu.items[j];
+            ok = blob.string(it.label, &item.label) &&
+                 blob.string(it.clicked, &item.clicked) &&
+                 blob.string(it.action, &item.action);
+            item.action_id = it.action_id;
+            item.use_on_mac = (it.flags & SmlbItem_UseOnMac) != 0;
+            item.is_separator = (it.flags & SmlbItem_Separator) != 0;
+        }
+    }
+
+    dock.toolbar_tools.resize(header.toolbar_tool_count);
+    for (uint32_t i = 0; ok && i < header.toolbar_tool_count; ++i)
+        ok = blob.string(blob.record<SmlbString>(header.tools_offset, i), &dock.toolbar_tools[i]);
+    dock.left_tools.resize(header.left_tool_count);
+    for (uint32_t i = 0; ok && i < header.left_tool_count; ++i)
+        ok = blob.string(blob.record<SmlbString>(header.tools_offset, header.toolbar_tool_count + i), &dock.left_tools[i]);
+
+    // Nodes are stored in index order, so every parent precedes its
+    // children and addNode() hands back the same indices.
+    UiNodeTree& tree = window->tree;
+    for (uint32_t i = 0; ok && i < header.node_count; ++i) {
+        SmlbNode n = blob.record<SmlbNode>(header.nodes_offset, i);
+        if ((n.parent != UiNodeTree::kNone && n.parent >= i) || n.type > 0xff ||
+            (uint64_t)n.first_property + n.property_count > header.node_property_count)
+            return false;
+        tree.addNode(n.parent, (uint8_t)n.type);
+        for (uint32_t j = 0; ok && j < n.property_count; ++j) {
+            SmlbNodeProperty p = blob.record<SmlbNodeProperty>(header.node_properties_offset, n.first_property + j);
+            UiNodeTree::Property stored;
+            stored.id = (uint8_t)p.id;
+            stored.kind = (uint8_t)p.kind;
+            sml::PropertyValue value;
+            value.type = (sml::PropertyValue::Type)p.kind;
+            if (UiNodeTree::isString(stored)) {
+                SmlbString ref;
+                ref.offset = (uint32_t)p.x;
+                ref.length = (uint32_t)p.y;
+                ok = blob.string(ref, &value.string_value);
+            } else {
+                value.int_value = p.x;
+                value.bool_value = p.x != 0;
+                value.vec2i_value.x = p.x;
+                value.vec2i_value.y = p.y;
+            }
+            tree.addProperty(i, (uint8_t)p.id, value);
+        }
+    }
+    tree.finalize();
+    return ok;
+}
+
+// Read-only view of a file, mapped where the platform allows it.
+class MappedFile {
+public:
+    MappedFile() {}
+    ~MappedFile() {
+#if !defined(_WIN32)
+        if (data_ && size_ > 0)
+            munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+
+    bool open(const std::string& path, std::string* error_message) {
+#if defined(_WIN32)
+        std::ifstream in(path.c_str(), std::ios::binary);
+        if (!in)
+            return fail(error_message, path);
+        buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        return true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return fail(error_message, path);
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return fail(error_message, path);
+        }
+        size_ = (size_t)st.st_size;
+        if (size_ > 0) {
+            void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                size_ = 0;
+                return fail(error_message, path);
+            }
+            data_ = static_cast<const char*>(mapped);
+        }
+        ::close(fd);
+        return true;
+#endif
+    }
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    static bool fail(std::string* error_message, const std::string& path) {
+        if (error_message)
+            *error_message = "Cannot open " + path;
+        return false;
+    }
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    std::vector<char> buffer_;
+#endif
+};
+
+} // namespace
+
+bool UiDocument::saveCompiled(const std::string& path, std::string* error_message) const {
+    std::vector<char> blob;
+    CompileWindow(*snapshot(), &blob);
+    std::string tmp_path = path + ".tmp";
+    FILE* f = std::fopen(tmp_path.c_str(), "wb");
+    if (!f) {
+        if (error_message)
+            *error_message = "Cannot write " + tmp_path;
+        return false;
+    }
+    bool ok = std::fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+    ok = (std::fclose(f) == 0) && ok;
+    if (ok)
+        ok = std::rename(tmp_path.c_str(), path.c_str()) == 0;
+    if (!ok) {
+        std::remove(tmp_path.c_str());
+        if (error_message)
+            *error_message = "Cannot write " + path;
+    }
+    return ok;
+}
+
+bool UiDocument::loadCompiled(const std::string& path, std::string* error_message) {
+    MappedFile file;
+    if (!file.open(path, error_message))
+        return false;
+    return loadCompiledFromMemory(file.data(), file.size(), error_message);
+}
+
+bool UiDocument::loadCompiledFromMemory(const void* data, size_t size, std::string* error_message) {
+    if (!data && size > 0) {
+        if (error_message)
+            *error_message = "Invalid .smlb: null data";
+        return false;
+    }
+    BlobReader blob(static_cast<const char*>(data), size);
+    if (!blob.validate(error_message))
+        return false;
+    std::shared_ptr<UiWindow> window = std::make_shared<UiWindow>();
+    if (!DecodeWindow(blob, window.get())) {
+        if (error_message)
+            *error_message = "Invalid .smlb: string or item reference out of range";
+        return false;
+    }
+    publish(std::move(window));
+    return true;
+}
+
+} // namespace smlui
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_diagnostics.h"
+#include "sml_ui_mpsc.h"
+
+namespace smlui {
+
+const char* UiSeverityText(UiSeverity severity) {
+    switch (severity) {
+    case UiSeverity::Info: return "Info";
+    case UiSeverity::Warning: return "Warning";
+    case UiSeverity::Error: return "Error";
+    }
+    return "";
+}
+
+const char* UiDiagnosticCodeText(UiDiagnosticCode code) {
+    switch (code) {
+    case UiDiagnosticCode::UnknownElement: return "Unknown element";
+    case UiDiagnosticCode::UnknownProperty: return "Unknown property";
+    case UiDiagnosticCode::ParseError: return "Parse error";
+    }
+    return "";
+}
+
+std::string FormatDiagnostic(const UiDiagnostic& diagnostic) {
+    std::string text = "UI ";
+    text += UiSeverityText(diagnostic.severity);
+    text += ": ";
+    text += UiDiagnosticCodeText(diagnostic.code);
+    text += " -> ";
+    text += diagnostic.detail;
+    if (!diagnostic.source.empty() || diagnostic.line > 0 || diagnostic.count > 1) {
+        text += " (";
+        std::string location = diagnostic.source;
+        if (diagnostic.line > 0) {
+            if (!location.empty())
+                location += ":";
+            location += std::to_string(diagnostic.line) + ":" + std::to_string(diagnostic.column);
+        }
+        text += location;
+        if (diagnostic.count > 1)
+            text += (location.empty() ? "" : ", ") + std::to_string(diagnostic.count) + "x";
+        text += ")";
+    }
+    return text;
+}
+
+UiDiagnosticQueue::~UiDiagnosticQueue() {
+    MpscDeleteAll(&head_);
+}
+
+void UiDiagnosticQueue::push(std::vector<UiDiagnostic> batch) {
+    if (batch.empty())
+        return;
+    Node* node = new Node();
+    node->batch = std::move(batch);
+    MpscPush(&head_, node);
+}
+
+size_t UiDiagnosticQueue::drain(std::vector<UiDiagnostic>* out) {
+    Node* ordered = MpscTakeAll(&head_);
+    size_t drained = 0;
+    while (ordered) {
+        Node* next = ordered->next;
+        drained += ordered->batch.size();
+        if (out)
+            out->insert(out->end(), ordered->batch.begin(), ordered->batch.end());
+        delete ordered;
+        ordered = next;
+    }
+    return drained;
+}
+
+UiDiagnosticsWriter::UiDiagnosticsWriter(FILE* stream) : stream_(stream) {
+    worker_ = std::thread(&UiDiagnosticsWriter::run, this);
+}
+
+UiDiagnosticsWriter::~UiDiagnosticsWriter() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        stop_requested_ = true;
+        wake_.notify_one();
+    }
+    worker_.join();
+}
+
+void UiDiagnosticsWriter::post(const std::vector<UiDiagnostic>& batch) {
+    if (batch.empty())
+        return;
+    queue_.push(batch);
+    // Notifying under the mutex orders the push against the worker's
+    // predicate check, so the wake-up cannot fall between check and wait.
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    wake_.notify_one();
+}
+
+void UiDiagnosticsWriter::run() {
+    std::vector<UiDiagnostic> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_.wait(lock, [this]() { return stop_requested_.load() || !queue_.empty(); });
+        }
+        bool stopping = stop_requested_.load();
+        batch.clear();
+        if (queue_.drain(&batch) > 0)
+            write(batch);
+        else if (stopping)
+            return;
+    }
+}
+
+void UiDiagnosticsWriter::write(const std::vector<UiDiagnostic>& batch) {
+    if (!stream_)
+        return;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        std::string line = FormatDiagnostic(batch[i]);
+        std::fwrite(line.data(), 1, line.size(), stream_);
+        std::fputc('\n', stream_);
+    }
+    std::fflush(stream_);
+}
+
+} // namespace smlui
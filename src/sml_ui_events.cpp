@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_events.h"
+#include "sml_ui_mpsc.h"
+
+namespace smlui {
+
+UiEventQueue::~UiEventQueue() {
+    MpscDeleteAll(&head_);
+}
+
+void UiEventQueue::push(const UiEvent& event) {
+    Node* node = new Node();
+    node->event = event;
+    MpscPush(&head_, node);
+}
+
+size_t UiEventQueue::drain(std::vector<UiEvent>* out, bool coalesce) {
+    Node* ordered = MpscTakeAll(&head_);
+    size_t drained = 0;
+    const size_t first = out ? out->size() : 0;
+    while (ordered) {
+        Node* next = ordered->next;
+        ++drained;
+        if (out) {
+            bool folded = false;
+            // Drains hold a handful of events, so a linear scan is enough.
+            for (size_t i = first; coalesce && i < out->size(); ++i) {
+                UiEvent& existing = (*out)[i];
+                if (existing.type == ordered->event.type && existing.action_id == ordered->event.action_id) {
+                    existing.count += ordered->event.count;
+                    folded = true;
+                    break;
+                }
+            }
+            if (!folded)
+                out->push_back(ordered->event);
+        }
+        delete ordered;
+        ordered = next;
+    }
+    return drained;
+}
+
+} // namespace smlui
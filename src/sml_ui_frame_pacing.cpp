@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_frame_pacing.h"
+#include "imgui_internal.h"
+
+#include <algorithm>
+
+namespace smlui {
+
+namespace {
+
+// Mailbox replaces the queued image instead of waiting for vblank;
+// immediate may tear. FIFO is the only mode every surface supports.
+const VkPresentModeKHR kLatencyPresentModes[] = {
+    VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_FIFO_KHR
+};
+const VkPresentModeKHR kThroughputPresentModes[] = {VK_PRESENT_MODE_FIFO_KHR};
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double Percentile(std::vector<double> values, double p) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    return values[(size_t)(p * (double)(values.size() - 1))];
+}
+
+} // namespace
+
+void UiFramePacer::configure(const UiWindow::UiState& state) {
+    configure(state.present_mode == "latency" ? UiPresentMode::Latency : UiPresentMode::Throughput,
+              state.frames_in_flight);
+}
+
+void UiFramePacer::configure(UiPresentMode mode, int frames_in_flight) {
+    mode_ = mode;
+    if (frames_in_flight <= 0)
+        frames_in_flight = mode == UiPresentMode::Latency ? 1 : 2;
+    frames_in_flight_ = std::min(frames_in_flight, (int)kMaxFramesInFlight);
+    input_ns_.store(0);
+    samples_ms_.clear();
+    sample_count_ = 0;
+    last_ms_ = 0.0;
+    max_ms_ = 0.0;
+}
+
+const VkPresentModeKHR* UiFramePacer::presentModes(int* count) const {
+    if (mode_ == UiPresentMode::Latency) {
+        *count = (int)(sizeof(kLatencyPresentModes) / sizeof(kLatencyPresentModes[0]));
+        return kLatencyPresentModes;
+    }
+    *count = (int)(sizeof(kThroughputPresentModes) / sizeof(kThroughputPresentModes[0]));
+    return kThroughputPresentModes;
+}
+
+uint32_t UiFramePacer::minImageCount(VkPresentModeKHR present_mode) const {
+    // Mailbox needs a spare image to replace; FIFO keeps one queued for
+    // throughput; immediate never waits on the presentation engine.
+    if (present_mode == VK_PRESENT_MODE_MAILBOX_KHR)
+        return 3;
+    if (present_mode == VK_PRESENT_MODE_FIFO_KHR && mode_ == UiPresentMode::Throughput)
+        return 3;
+    return 2;
+}
+
+void UiFramePacer::waitForFrameSlot(VkDevice device) {
+    while ((int)pending_.size() >= frames_in_flight_) {
+        VkFence fence = pending_.front();
+        pending_.erase(pending_.begin());
+        // The helpers reuse a fence only after waiting on it, so a fence
+        // reset for a newer frame just makes this wait for that frame.
+        vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
+    }
+}
+
+void UiFramePacer::frameSubmitted(VkFence fence) {
+    pending_.erase(std::remove(pending_.begin(), pending_.end(), fence), pending_.end());
+    pending_.push_back(fence);
+
+    int64_t input_ns = input_ns_.exchange(0);
+    if (input_ns == 0)
+        return;
+    last_ms_ = (double)(NowNs() - input_ns) / 1e6;
+    max_ms_ = std::max(max_ms_, last_ms_);
+    if (samples_ms_.size() < (size_t)kLatencyWindow)
+        samples_ms_.push_back(last_ms_);
+    else
+        samples_ms_[sample_count_ % kLatencyWindow] = last_ms_;
+    ++sample_count_;
+}
+
+void UiFramePacer::inputReceived() {
+    int64_t expected = 0;
+    input_ns_.compare_exchange_strong(expected, NowNs());
+}
+
+void UiFramePacer::beginFrame() {
+    const ImGuiContext* ctx = ImGui::GetCurrentContext();
+    if (ctx && ctx->InputEventsQueue.Size > 0)
+        inputReceived();
+}
+
+UiLatencyStats UiFramePacer::latency() const {
+    UiLatencyStats stats;
+    stats.samples = sample_count_;
+    stats.last_ms = last_ms_;
+    stats.p50_ms = Percentile(samples_ms_, 0.5);
+    stats.p99_ms = Percentile(samples_ms_, 0.99);
+    stats.max_ms = max_ms_;
+    return stats;
+}
+
+} // namespace smlui
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_loader.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace smlui {
+
+// Each worker owns a deque: it takes work from the front of its own and,
+// when that is empty, steals from the back of the others. Submissions are
+// spread round-robin so a batch starts out evenly distributed.
+class UiDocumentLoader::Pool {
+public:
+    explicit Pool(unsigned thread_count) {
+        for (unsigned i = 0; i < thread_count; ++i)
+            queues_.push_back(std::unique_ptr<Queue>(new Queue()));
+        for (unsigned i = 0; i < thread_count; ++i)
+            threads_.push_back(std::thread(&Pool::run, this, i));
+    }
+
+    ~Pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_available_.notify_all();
+        for (size_t i = 0; i < threads_.size(); ++i)
+            threads_[i].join();
+    }
+
+    unsigned size() const { return (unsigned)threads_.size(); }
+
+    void submit(std::function<void()> task) {
+        Queue& queue = *queues_[next_queue_++ % queues_.size()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++queued_;
+            ++pending_;
+        }
+        work_available_.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        all_done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    bool take(unsigned index, std::function<void()>* task) {
+        for (size_t n = 0; n < queues_.size(); ++n) {
+            Queue& queue = *queues_[(index + n) % queues_.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+            if (n == 0) {
+                *task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            } else {
+                *task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void run(unsigned index) {
+        for (;;) {
+            std::function<void()> task;
+            if (take(index, &task)) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    --queued_;
+                }
+                task();
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0)
+                    all_done_.notify_all();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_available_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+            if (stopping_ && queued_ == 0)
+                return;
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<unsigned> next_queue_{0};
+    std::mutex mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable all_done_;
+    size_t queued_ = 0;
+    size_t pending_ = 0;
+    bool stopping_ = false;
+};
+
+namespace {
+
+bool EndsWith(const std::string& text, const char* suffix) {
+    size_t length = std::char_traits<char>::length(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+UiLoadResult LoadOne(const std::string& path, const std::shared_ptr<const UiSchema>& schema) {
+    UiLoadResult result;
+    result.path = path;
+    result.document = std::make_shared<UiDocument>();
+    result.document->setSchema(schema);
+    if (EndsWith(path, ".smlb")) {
+        result.ok = result.document->loadCompiled(path, &result.error_message);
+        return result;
+    }
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in) {
+        result.error_message = "Cannot open " + path;
+        return result;
+    }
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    result.ok = result.document->parseFromString(text, &result.error_message);
+    result.document->drainDiagnostics(&result.diagnostics);
+    for (size_t i = 0; i < result.diagnostics.size(); ++i)
+        result.diagnostics[i].source = path;
+    return result;
+}
+
+} // namespace
+
+UiDocumentLoader::UiDocumentLoader(unsigned thread_count) : schema_(UiSchema::builtin()) {
+    if (thread_count == 0)
+        thread_count = std::thread::hardware_concurrency();
+    if (thread_count == 0)
+        thread_count = 1;
+    pool_.reset(new Pool(thread_count));
+}
+
+UiDocumentLoader::~UiDocumentLoader() {
+    pool_.reset();
+}
+
+void UiDocumentLoader::setSchema(std::shared_ptr<const UiSchema> schema) {
+    schema_ = schema ? std::move(schema) : UiSchema::builtin();
+}
+
+unsigned UiDocumentLoader::threadCount() const {
+    return pool_->size();
+}
+
+std::vector<std::future<UiLoadResult>> UiDocumentLoader::loadAsync(const std::vector<std::string>& paths) {
+    std::vector<std::future<UiLoadResult>> futures;
+    futures.reserve(paths.size());
+    std::shared_ptr<const UiSchema> schema = schema_;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        std::shared_ptr<std::packaged_task<UiLoadResult()>> task =
+            std::make_shared<std::packaged_task<UiLoadResult()>>(std::bind(LoadOne, paths[i], schema));
+        futures.push_back(task->get_future());
+        pool_->submit([task] { (*task)(); });
+    }
+    return futures;
+}
+
+void UiDocumentLoader::loadAsync(const std::vector<std::string>& paths, CompletionCallback callback, void* user_data) {
+    std::shared_ptr<const UiSchema> schema = schema_;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        std::string path = paths[i];
+        pool_->submit([path, schema, callback, user_data] {
+            UiLoadResult result;
+            try {
+                result = LoadOne(path, schema);
+            } catch (const std::exception& e) {
+                result.path = path;
+                result.ok = false;
+                result.error_message = e.what();
+            }
+            if (callback)
+                callback(result, user_data);
+        });
+    }
+}
+
+std::vector<UiLoadResult> UiDocumentLoader::loadAll(const std::vector<std::string>& paths, size_t* out_failed) {
+    std::vector<std::future<UiLoadResult>> futures = loadAsync(paths);
+    std::vector<UiLoadResult> results;
+    results.reserve(futures.size());
+    size_t failed = 0;
+    for (size_t i = 0; i < futures.size(); ++i) {
+        try {
+            results.push_back(futures[i].get());
+        } catch (const std::exception& e) {
+            UiLoadResult result;
+            result.path = paths[i];
+            result.error_message = e.what();
+            results.push_back(result);
+        }
+        if (!results.back().ok)
+            ++failed;
+    }
+    if (out_failed)
+        *out_failed = failed;
+    return results;
+}
+
+void UiDocumentLoader::wait() {
+    pool_->wait();
+}
+
+} // namespace smlui
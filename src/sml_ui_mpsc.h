@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_MPSC_H
+#define SML_UI_MPSC_H
+
+#include <atomic>
+
+namespace smlui {
+
+// Intrusive multi-producer list shared by UiEventQueue and
+// UiDiagnosticQueue. Node is any struct with a `Node* next` member.
+// Producers push with a single CAS on the head; the consumer detaches the
+// whole list with one exchange and gets it back in push order.
+
+template <typename Node>
+void MpscPush(std::atomic<Node*>* head, Node* node) {
+    node->next = head->load(std::memory_order_relaxed);
+    while (!head->compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+// The caller owns the returned nodes.
+template <typename Node>
+Node* MpscTakeAll(std::atomic<Node*>* head) {
+    Node* node = head->exchange(nullptr, std::memory_order_acquire);
+    // The list is newest-first; reverse it into push order.
+    Node* ordered = nullptr;
+    while (node) {
+        Node* next = node->next;
+        node->next = ordered;
+        ordered = node;
+        node = next;
+    }
+    return ordered;
+}
+
+template <typename Node>
+void MpscDeleteAll(std::atomic<Node*>* head) {
+    Node* node = head->exchange(nullptr);
+    while (node) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+} // namespace smlui
+
+#endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Pipeline cache file layout (native endianness):
+//
+//   PipelineCacheFileHeader
+//   char data[data_size]            (vkGetPipelineCacheData() output)
+//
+// The Vulkan blob carries vendor, device and UUID but not the driver
+// version, so the file header repeats all of them and adds a checksum.
+// Bump kPipelineCacheVersion whenever the header layout changes.
+
+#include "sml_ui_pipeline_cache.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace smlui {
+
+namespace {
+
+const char kPipelineCacheMagic[4] = {'S', 'M', 'P', 'C'};
+const uint32_t kPipelineCacheVersion = 1;
+
+struct PipelineCacheFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t uuid[VK_UUID_SIZE];
+    uint32_t data_size;
+    uint32_t checksum;
+    uint32_t reserved;
+    uint64_t cold_create_us;
+};
+
+// Start of every blob returned by vkGetPipelineCacheData().
+struct VulkanCacheHeader {
+    uint32_t header_size;
+    uint32_t header_version;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint8_t uuid[VK_UUID_SIZE];
+};
+
+uint32_t Fnv1a(const char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= (uint8_t)data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Returns an empty string if file holds cache data usable on this device.
+std::string Validate(const std::vector<char>& file, const VkPhysicalDeviceProperties& properties) {
+    PipelineCacheFileHeader header;
+    if (file.size() < sizeof(header))
+        return "truncated header";
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, kPipelineCacheMagic, sizeof(kPipelineCacheMagic)) != 0)
+        return "not a pipeline cache file";
+    if (header.version != kPipelineCacheVersion)
+        return "unsupported file version";
+    if (header.vendor_id != properties.vendorID)
+        return "vendor changed";
+    if (header.device_id != properties.deviceID)
+        return "device changed";
+    if (header.driver_version != properties.driverVersion)
+        return "driver version changed";
+    if (std::memcmp(header.uuid, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+        return "pipeline cache UUID changed";
+    if (file.size() - sizeof(header) != header.data_size)
+        return "size mismatch";
+    const char* data = file.data() + sizeof(header);
+    if (Fnv1a(data, header.data_size) != header.checksum)
+        return "checksum mismatch";
+
+    VulkanCacheHeader blob;
+    if (header.data_size < sizeof(blob))
+        return "truncated cache data";
+    std::memcpy(&blob, data, sizeof(blob));
+    if (blob.header_size < sizeof(blob) || blob.header_version != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+        blob.vendor_id != properties.vendorID || blob.device_id != properties.deviceID ||
+        std::memcmp(blob.uuid, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+        return "cache data header mismatch";
+    return std::string();
+}
+
+} // namespace
+
+UiPipelineCache::~UiPipelineCache() {
+    destroy();
+}
+
+bool UiPipelineCache::load(VkPhysicalDevice physical_device, VkDevice device, const std::string& path,
+                           const VkAllocationCallbacks* allocator, std::string* error_message) {
+    destroy();
+    device_ = device;
+    allocator_ = allocator;
+    path_ = path;
+    stats_ = UiPipelineCacheStats();
+    vkGetPhysicalDeviceProperties(physical_device, &properties_);
+
+    std::vector<char> file;
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (in) {
+        file.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        stats_.rejected = Validate(file, properties_);
+    }
+
+    VkPipelineCacheCreateInfo info = {};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    if (!file.empty() && stats_.rejected.empty()) {
+        PipelineCacheFileHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        info.initialDataSize = header.data_size;
+        info.pInitialData = file.data() + sizeof(header);
+        stats_.cold_create_ms = (double)header.cold_create_us / 1000.0;
+    }
+    VkResult err = vkCreatePipelineCache(device_, &info, allocator_, &cache_);
+    if (err != VK_SUCCESS && info.initialDataSize > 0) {
+        // Some drivers refuse data they wrote themselves after an update
+        // that kept the version; start empty rather than without a cache.
+        stats_.rejected = "rejected by driver";
+        stats_.cold_create_ms = 0.0;
+        info.initialDataSize = 0;
+        info.pInitialData = nullptr;
+        err = vkCreatePipelineCache(device_, &info, allocator_, &cache_);
+    }
+    if (err != VK_SUCCESS) {
+        cache_ = VK_NULL_HANDLE;
+        if (error_message)
+            *error_message = "Cannot create pipeline cache";
+        return false;
+    }
+    stats_.warm = info.initialDataSize > 0;
+    stats_.loaded_bytes = info.initialDataSize;
+    return true;
+}
+
+bool UiPipelineCache::save(std::string* error_message) {
+    if (cache_ == VK_NULL_HANDLE) {
+        if (error_message)
+            *error_message = "No pipeline cache";
+        return false;
+    }
+    size_t size = 0;
+    std::vector<char> blob;
+    VkResult err = vkGetPipelineCacheData(device_, cache_, &size, nullptr);
+    if (err == VK_SUCCESS) {
+        blob.resize(sizeof(PipelineCacheFileHeader) + size);
+        err = vkGetPipelineCacheData(device_, cache_, &size, blob.data() + sizeof(PipelineCacheFileHeader));
+        blob.resize(sizeof(PipelineCacheFileHeader) + size);
+    }
+    if (err != VK_SUCCESS) {
+        if (error_message)
+            *error_message = "Cannot read pipeline cache data";
+        return false;
+    }
+
+    // A warm start keeps the cold time of the run that first wrote the
+    // file, so saved_ms stays comparable across launches.
+    double cold_ms = stats_.warm ? stats_.cold_create_ms : stats_.create_ms;
+    PipelineCacheFileHeader header = {};
+    std::memcpy(header.magic, kPipelineCacheMagic, sizeof(kPipelineCacheMagic));
+    header.version = kPipelineCacheVersion;
+    header.vendor_id = properties_.vendorID;
+    header.device_id = properties_.deviceID;
+    header.driver_version = properties_.driverVersion;
+    std::memcpy(header.uuid, properties_.pipelineCacheUUID, VK_UUID_SIZE);
+    header.data_size = (uint32_t)size;
+    header.checksum = Fnv1a(blob.data() + sizeof(header), size);
+    header.cold_create_us = (uint64_t)(cold_ms * 1000.0);
+    std::memcpy(blob.data(), &header, sizeof(header));
+
+    std::string tmp_path = path_ + ".tmp";
+    FILE* f = std::fopen(tmp_path.c_str(), "wb");
+    if (!f) {
+        if (error_message)
+            *error_message = "Cannot write " + tmp_path;
+        return false;
+    }
+    bool ok = std::fwrite(blob.data(), 1, blob.size(), f) == blob.size();
+    ok = (std::fclose(f) == 0) && ok;
+    if (ok)
+        ok = std::rename(tmp_path.c_str(), path_.c_str()) == 0;
+    if (!ok) {
+        std::remove(tmp_path.c_str());
+        if (error_message)
+            *error_message = "Cannot write " + path_;
+        return false;
+    }
+    stats_.saved_bytes = blob.size();
+    return true;
+}
+
+void UiPipelineCache::destroy() {
+    if (cache_ != VK_NULL_HANDLE)
+        vkDestroyPipelineCache(device_, cache_, allocator_);
+    cache_ = VK_NULL_HANDLE;
+}
+
+void UiPipelineCache::beginCreation() {
+    creation_start_ = std::chrono::steady_clock::now();
+}
+
+void UiPipelineCache::endCreation() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    stats_.create_ms += std::chrono::duration<double, std::milli>(now - creation_start_).count();
+    if (stats_.warm && stats_.cold_create_ms > 0.0)
+        stats_.saved_ms = stats_.cold_create_ms - stats_.create_ms;
+}
+
+} // namespace smlui
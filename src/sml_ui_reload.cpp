@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_reload.h"
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+
+#include <sys/stat.h>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace smlui {
+
+namespace {
+
+// Editors usually save through several events (truncate, write, rename);
+// wait for the burst to settle before re-parsing.
+const int kDebounceMs = 30;
+
+#if !defined(__linux__)
+const int kPollIntervalMs = 250;
+
+bool FileStamp(const std::string& path, long long* stamp) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+        return false;
+    *stamp = (long long)st.st_mtime * 1000000000LL + (long long)st.st_size;
+    return true;
+}
+#endif
+
+} // namespace
+
+bool UiLayoutWatcher::watch(UiDocument* document, const std::string& path, std::string* error_message) {
+    stop();
+    if (!document) {
+        if (error_message)
+            *error_message = "No document to reload";
+        return false;
+    }
+    document_ = document;
+    path_ = path;
+    size_t slash = path.find_last_of("/\\");
+    directory_ = slash == std::string::npos ? std::string(".") : path.substr(0, slash == 0 ? 1 : slash);
+    file_name_ = slash == std::string::npos ? path : path.substr(slash + 1);
+
+#if defined(__linux__)
+    // Watch the directory rather than the file: editors that save by
+    // renaming a temp file over the original would orphan a file watch.
+    notify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (notify_fd_ < 0 ||
+        inotify_add_watch(notify_fd_, directory_.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0 ||
+        pipe2(wake_fd_, O_CLOEXEC) != 0) {
+        if (error_message)
+            *error_message = "Cannot watch " + directory_;
+        stop();
+        return false;
+    }
+#endif
+    stop_requested_ = false;
+    worker_ = std::thread(&UiLayoutWatcher::run, this);
+    return true;
+}
+
+void UiLayoutWatcher::stop() {
+    stop_requested_ = true;
+#if defined(__linux__)
+    if (wake_fd_[1] >= 0) {
+        char byte = 0;
+        ssize_t written = write(wake_fd_[1], &byte, 1);
+        (void)written;
+    }
+#endif
+    if (worker_.joinable())
+        worker_.join();
+#if defined(__linux__)
+    if (notify_fd_ >= 0)
+        close(notify_fd_);
+    for (int i = 0; i < 2; ++i) {
+        if (wake_fd_[i] >= 0)
+            close(wake_fd_[i]);
+        wake_fd_[i] = -1;
+    }
+#endif
+    notify_fd_ = -1;
+}
+
+void UiLayoutWatcher::run() {
+#if defined(__linux__)
+    alignas(struct inotify_event) char buffer[4096];
+    bool pending = false;
+    while (!stop_requested_) {
+        struct pollfd fds[2];
+        fds[0].fd = notify_fd_;
+        fds[0].events = POLLIN;
+        fds[1].fd = wake_fd_[0];
+        fds[1].events = POLLIN;
+        int ready = poll(fds, 2, pending ? kDebounceMs : -1);
+        if (ready < 0)
+            continue;
+        if (fds[1].revents & POLLIN)
+            break;
+        if (ready == 0) {
+            pending = false;
+            reload();
+            continue;
+        }
+        ssize_t length;
+        while ((length = read(notify_fd_, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + length;) {
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(p);
+                if (event->len > 0 && file_name_ == event->name)
+                    pending = true;
+                p += sizeof(struct inotify_event) + event->len;
+            }
+        }
+    }
+#else
+    long long last_stamp = 0;
+    bool have_stamp = FileStamp(path_, &last_stamp);
+    while (!stop_requested_) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kPollIntervalMs));
+        long long stamp = 0;
+        if (!FileStamp(path_, &stamp) || (have_stamp && stamp == last_stamp))
+            continue;
+        last_stamp = stamp;
+        have_stamp = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(kDebounceMs));
+        reload();
+    }
+#endif
+}
+
+void UiLayoutWatcher::reload() {
+    std::string error;
+    bool ok = false;
+    std::ifstream in(path_.c_str(), std::ios::binary);
+    if (in) {
+        std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        // Parse into a private document so the live model is never touched
+        // until the new one is complete.
+        UiDocument fresh;
+        fresh.setSchema(document_->schema());
+        ok = fresh.parseFromString(text, &error);
+        std::vector<UiDiagnostic> diagnostics;
+        fresh.drainDiagnostics(&diagnostics);
+        for (size_t i = 0; i < diagnostics.size(); ++i)
+            diagnostics[i].source = path_;
+        document_->postDiagnostics(std::move(diagnostics));
+        if (ok)
+            document_->publish(fresh.snapshot());
+    } else {
+        error = "Cannot open " + path_;
+    }
+    if (ok)
+        ++reload_count_;
+    else
+        ++failed_reload_count_;
+    if (reload_callback_)
+        reload_callback_(ok, error, reload_user_data_);
+}
+
+} // namespace smlui
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SML_UI_SYMBOLS_H
+#define SML_UI_SYMBOLS_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace smlui {
+
+// Known SML element names. Order matches kElementNames.
+enum class ElementId : uint8_t {
+    Unknown = 0,
+    Window,
+    State,
+    Label,
+    MainMenu,
+    Menu,
+    MenuItem,
+    Separator,
+    DockLayout,
+    MenuBar,
+    ToolBar,
+    StatusBar,
+    PropertyPanel,
+    Viewport3D,
+    Overlay,
+    Top,
+    Bottom,
+    Left,
+    Right,
+    Center,
+    ToolButton,
+    Column,
+    Row,
+    Button,
+    ListView,
+    Count
+};
+
+// Known SML property names. Order matches kPropertyNames.
+enum class PropertyId : uint8_t {
+    Unknown = 0,
+    Title,
+    Position,
+    Size,
+    Persist,
+    Theme,
+    Pos,
+    Maximized,
+    LastFilePath,
+    Docking,
+    Text,
+    FontSize,
+    Label,
+    Clicked,
+    Action,
+    UseOnMac,
+    Height,
+    Width,
+    Icon,
+    Source,
+    PresentMode,
+    FramesInFlight,
+    Count
+};
+
+static const char* const kElementNames[] = {
+    "", "Window", "state", "Label", "MainMenu", "Menu", "MenuItem", "Separator",
+    "DockLayout", "MenuBar", "ToolBar", "StatusBar", "PropertyPanel", "Viewport3D",
+    "Overlay", "Top", "Bottom", "Left", "Right", "Center", "ToolButton",
+    "Column", "Row", "Button", "ListView"
+};
+
+static const char* const kPropertyNames[] = {
+    "", "title", "position", "size", "persist", "theme", "pos", "maximized",
+    "lastFilePath", "docking", "text", "fontSize", "label", "clicked", "action",
+    "useOnMac", "height", "width", "icon", "source", "presentMode", "framesInFlight"
+};
+
+static_assert(sizeof(kElementNames) / sizeof(kElementNames[0]) == (size_t)ElementId::Count,
+              "kElementNames out of sync with ElementId");
+static_assert(sizeof(kPropertyNames) / sizeof(kPropertyNames[0]) == (size_t)PropertyId::Count,
+              "kPropertyNames out of sync with PropertyId");
+
+// FNV-1a, usable in case labels. The switch statements below double as the
+// perfect hash: the compiler rejects duplicate case values, so any collision
+// among known names is a build error rather than a silent mis-dispatch.
+constexpr uint32_t SymbolHash(const char* s, uint32_t h = 2166136261u) {
+    return *s ? SymbolHash(s + 1, (h ^ (uint32_t)(unsigned char)*s) * 16777619u) : h;
+}
+
+inline uint32_t SymbolHash(const char* s, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; ++i)
+        h = (h ^ (uint32_t)(unsigned char)s[i]) * 16777619u;
+    return h;
+}
+
+inline const char* ElementName(ElementId id) {
+    return kElementNames[(size_t)id];
+}
+
+inline const char* PropertyName(PropertyId id) {
+    return kPropertyNames[(size_t)id];
+}
+
+#define SMLUI_SYMBOL_CASE(literal, value) \
+    case SymbolHash(literal): \
+        if (name.size() == sizeof(literal) - 1 && std::memcmp(name.data(), literal, sizeof(literal) - 1) == 0) \
+            return value; \
+        break;
+
+inline ElementId LookupElement(const std::string& name) {
+    switch (SymbolHash(name.data(), name.size())) {
+    SMLUI_SYMBOL_CASE("Window", ElementId::Window)
+    SMLUI_SYMBOL_CASE("state", ElementId::State)
+    SMLUI_SYMBOL_CASE("Label", ElementId::Label)
+    SMLUI_SYMBOL_CASE("MainMenu", ElementId::MainMenu)
+    SMLUI_SYMBOL_CASE("Menu", ElementId::Menu)
+    SMLUI_SYMBOL_CASE("MenuItem", ElementId::MenuItem)
+    SMLUI_SYMBOL_CASE("Separator", ElementId::Separator)
+    SMLUI_SYMBOL_CASE("DockLayout", ElementId::DockLayout)
+    SMLUI_SYMBOL_CASE("MenuBar", ElementId::MenuBar)
+    SMLUI_SYMBOL_CASE("ToolBar", ElementId::ToolBar)
+    SMLUI_SYMBOL_CASE("StatusBar", ElementId::StatusBar)
+    SMLUI_SYMBOL_CASE("PropertyPanel", ElementId::PropertyPanel)
+    SMLUI_SYMBOL_CASE("Viewport3D", ElementId::Viewport3D)
+    SMLUI_SYMBOL_CASE("Overlay", ElementId::Overlay)
+    SMLUI_SYMBOL_CASE("Top", ElementId::Top)
+    SMLUI_SYMBOL_CASE("Bottom", ElementId::Bottom)
+    SMLUI_SYMBOL_CASE("Left", ElementId::Left)
+    SMLUI_SYMBOL_CASE("Right", ElementId::Right)
+    SMLUI_SYMBOL_CASE("Center", ElementId::Center)
+    SMLUI_SYMBOL_CASE("ToolButton", ElementId::ToolButton)
+    SMLUI_SYMBOL_CASE("Column", ElementId::Column)
+    SMLUI_SYMBOL_CASE("Row", ElementId::Row)
+    SMLUI_SYMBOL_CASE("Button", ElementId::Button)
+    SMLUI_SYMBOL_CASE("ListView", ElementId::ListView)
+    default: break;
+    }
+    return ElementId::Unknown;
+}
+
+inline PropertyId LookupProperty(const std::string& name) {
+    switch (SymbolHash(name.data(), name.size())) {
+    SMLUI_SYMBOL_CASE("title", PropertyId::Title)
+    SMLUI_SYMBOL_CASE("position", PropertyId::Position)
+    SMLUI_SYMBOL_CASE("size", PropertyId::Size)
+    SMLUI_SYMBOL_CASE("persist", PropertyId::Persist)
+    SMLUI_SYMBOL_CASE("theme", PropertyId::Theme)
+    SMLUI_SYMBOL_CASE("pos", PropertyId::Pos)
+    SMLUI_SYMBOL_CASE("maximized", PropertyId::Maximized)
+    SMLUI_SYMBOL_CASE("lastFilePath", PropertyId::LastFilePath)
+    SMLUI_SYMBOL_CASE("docking", PropertyId::Docking)
+    SMLUI_SYMBOL_CASE("text", PropertyId::Text)
+    SMLUI_SYMBOL_CASE("fontSize", PropertyId::FontSize)
+    SMLUI_SYMBOL_CASE("label", PropertyId::Label)
+    SMLUI_SYMBOL_CASE("clicked", PropertyId::Clicked)
+    SMLUI_SYMBOL_CASE("action", PropertyId::Action)
+    SMLUI_SYMBOL_CASE("useOnMac", PropertyId::UseOnMac)
+    SMLUI_SYMBOL_CASE("height", PropertyId::Height)
+    SMLUI_SYMBOL_CASE("width", PropertyId::Width)
+    SMLUI_SYMBOL_CASE("icon", PropertyId::Icon)
+    SMLUI_SYMBOL_CASE("source", PropertyId::Source)
+    SMLUI_SYMBOL_CASE("presentMode", PropertyId::PresentMode)
+    SMLUI_SYMBOL_CASE("framesInFlight", PropertyId::FramesInFlight)
+    default: break;
+    }
+    return PropertyId::Unknown;
+}
+
+#undef SMLUI_SYMBOL_CASE
+
+} // namespace smlui
+
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 CrowdWare
+ *
+ * This file is part of SMLUI.
+ *
+ *  SMLUI is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  SMLUI is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with SMLUI.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sml_ui_tree.h"
+
+namespace smlui {
+
+const UiNodeTree::Index UiNodeTree::kNone;
+
+UiNodeTree::Index UiNodeTree::addNode(Index parent, uint8_t type) {
+    Index node = (Index)types_.size();
+    types_.push_back(type);
+    parents_.push_back(parent);
+    first_children_.push_back(kNone);
+    next_siblings_.push_back(kNone);
+    last_children_.push_back(kNone);
+    Index* previous = parent == kNone ? &last_root_ : &last_children_[parent];
+    if (*previous != kNone)
+        next_siblings_[*previous] = node;
+    else if (parent != kNone)
+        first_children_[parent] = node;
+    *previous = node;
+    return node;
+}
+
+void UiNodeTree::addProperty(Index node, uint8_t id, const sml::PropertyValue& value) {
+    Property property;
+    property.id = id;
+    property.kind = (uint8_t)value.type;
+    property.x = 0;
+    property.y = 0;
+    switch (value.type) {
+    case sml::PropertyValue::Int: property.x = value.int_value; break;
+    case sml::PropertyValue::Boolean: property.x = value.bool_value ? 1 : 0; break;
+    case sml::PropertyValue::Vec2iType:
+        property.x = value.vec2i_value.x;
+        property.y = value.vec2i_value.y;
+        break;
+    default:
+        property.x = (int32_t)strings_.size();
+        property.y = (int32_t)value.string_value.size();
+        strings_.append(value.string_value);
+        strings_.push_back('\0');
+        break;
+    }
+    if (!property_nodes_.empty() && node < property_nodes_.back())
+        sorted_ = false;
+    properties_.push_back(property);
+    property_nodes_.push_back(node);
+}
+
+void UiNodeTree::finalize() {
+    // Properties of a node arrive contiguously unless a child element sits
+    // between them; only then is a stable counting sort needed.
+    property_counts_.assign(types_.size(), 0);
+    for (size_t i = 0; i < property_nodes_.size(); ++i)
+        ++property_counts_[property_nodes_[i]];
+    first_properties_.resize(types_.size());
+    uint32_t offset = 0;
+    for (size_t i = 0; i < types_.size(); ++i) {
+        first_properties_[i] = offset;
+        offset += property_counts_[i];
+    }
+    if (!sorted_) {
+        std::vector<Property> sorted(properties_.size());
+        std::vector<Index> sorted_nodes(property_nodes_.size());
+        std::vector<uint32_t> cursor(first_properties_);
+        for (size_t i = 0; i < properties_.size(); ++i) {
+            uint32_t slot = cursor[property_nodes_[i]]++;
+            sorted[slot] = properties_[i];
+            sorted_nodes[slot] = property_nodes_[i];
+        }
+        properties_.swap(sorted);
+        property_nodes_.swap(sorted_nodes);
+        sorted_ = true;
+    }
+}
+
+const UiNodeTree::Property* UiNodeTree::properties(Index node, size_t* count) const {
+    if (node >= first_properties_.size()) {
+        *count = 0;
+        return nullptr;
+    }
+    *count = property_counts_[node];
+    return properties_.data() + first_properties_[node];
+}
+
+const UiNodeTree::Property* UiNodeTree::findProperty(Index node, uint8_t id) const {
+    size_t count = 0;
+    const Property* first = properties(node, &count);
+    // Last one wins, as with repeated properties in the flat model.
+    for (size_t i = count; i > 0; --i) {
+        if (first[i - 1].id == id)
+            return &first[i - 1];
+    }
+    return nullptr;
+}
+
+bool UiNodeTree::isString(const Property& property) {
+    return property.kind != sml::PropertyValue::Int && property.kind != sml::PropertyValue::Boolean &&
+           property.kind != sml::PropertyValue::Vec2iType;
+}
+
+const char* UiNodeTree::stringOr(Index node, uint8_t id, const char* fallback) const {
+    const Property* property = findProperty(node, id);
+    return property && isString(*property) && property->y > 0 ? string(*property) : fallback;
+}
+
+int UiNodeTree::intOr(Index node, uint8_t id, int fallback) const {
+    const Property* property = findProperty(node, id);
+    return property && property->kind == sml::PropertyValue::Int ? property->x : fallback;
+}
+
+size_t UiNodeTree::memoryUsage() const {
+    return types_.capacity() * sizeof(uint8_t) +
+           (parents_.capacity() + first_children_.capacity() + next_siblings_.capacity() + last_children_.capacity()) * sizeof(Index) +
+           (first_properties_.capacity() + property_counts_.capacity()) * sizeof(uint32_t) +
+           properties_.capacity() * sizeof(Property) + property_nodes_.capacity() * sizeof(Index) +
+           strings_.capacity();
+}
+
+} // namespace smlui